@@ -35,7 +35,7 @@ public func SetAmmo(id ammo, int new_value)
 {
 	var info = _inherited(ammo, new_value);
 	var hud = this->~GetHUDController();
-	if (hud)
+	if (hud && !this->~IsMaterializingCrewLoadout()) // The class system notifies the HUD once for the whole loadout
 	{
 		hud->~OnAmmoChange(this);
 	}
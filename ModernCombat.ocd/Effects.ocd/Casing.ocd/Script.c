@@ -23,7 +23,7 @@ func Hit(int dx, int dy)
 		SetRDir(-GetRDir());
 	}
 	
-	Sound(this.HitSound, {multiple = true});
+	Sound(this.HitSound, {multiple = true, priority = SOUND_Priority_Low});
 }
 
 /* --- Settings --- */
@@ -0,0 +1,231 @@
+/**
+	Shrapnel field
+
+	Simulates the fragments of a detonation, without an object for every
+	fragment. The fragments fly with gravity, hit the first target or the
+	landscape on their way, and draw a trail.
+
+	@note Use it like this:
+	{@code
+		var field = CMC_Effect_ShrapnelField->Create(this, damage);
+		field->AddFragment(angle, RandomX(70, 100));
+	}
+ */
+
+/* --- Properties --- */
+
+static const SHRAPNEL_Precision = 100;   // Positions and velocities are stored in 1/100 pixels
+static const SHRAPNEL_Lifetime = 105;    // Fragments that did not hit anything are removed after this many frames
+static const SHRAPNEL_TrailLength = 30;
+
+local field_x, field_y;       // Fragment positions, global coordinates
+local field_xdir, field_ydir; // Fragment velocities, per frame
+local field_damage;           // Damage of a fragment hit
+local field_layer;            // Object layer of the source, for finding targets
+local field_age;
+
+/* --- Interface --- */
+
+/**
+	Creates a field at the position of an object.
+
+	@par source The field gets the position, controller and object layer of this object.
+	@par damage The damage of a fragment hit.
+
+	@return object The field, add fragments with AddFragment().
+ */
+public func Create(object source, int damage)
+{
+	var field = CreateObject(CMC_Effect_ShrapnelField, source->GetX(), source->GetY(), NO_OWNER);
+	field->SetController(source->GetController());
+	field.field_damage = damage;
+	field.field_layer = source->GetObjectLayer();
+	return field;
+}
+
+
+/**
+	Adds a fragment at the position of the field.
+
+	@par angle The direction, in degrees.
+	@par speed The speed, like in SetVelocity().
+ */
+public func AddFragment(int angle, int speed)
+{
+	PushBack(field_x, GetX() * SHRAPNEL_Precision);
+	PushBack(field_y, GetY() * SHRAPNEL_Precision);
+	PushBack(field_xdir, +Sin(angle, speed * SHRAPNEL_Precision / 10));
+	PushBack(field_ydir, -Cos(angle, speed * SHRAPNEL_Precision / 10));
+	return this;
+}
+
+
+public func GetFragmentCount()
+{
+	return GetLength(field_x);
+}
+
+/* --- Engine callbacks --- */
+
+func Initialize()
+{
+	// Set a custom object layer, so that the object is excluded from searches
+	SetObjectLayer(this);
+	field_x = [];
+	field_y = [];
+	field_xdir = [];
+	field_ydir = [];
+	field_age = 0;
+	AddTimer(this.MoveFragments, 1);
+}
+
+/* --- Internals --- */
+
+func MoveFragments()
+{
+	ProfileBegin("ShrapnelField::MoveFragments");
+	field_age += 1;
+
+	// Move all fragments and get the area that they passed
+	var count = GetLength(field_x);
+	var gravity = GetGravity() / 5;
+	var start_x = [], start_y = [];
+	var left = LandscapeWidth(), top = LandscapeHeight(), right = 0, bottom = 0;
+	for (var i = 0; i < count; ++i)
+	{
+		start_x[i] = field_x[i] / SHRAPNEL_Precision;
+		start_y[i] = field_y[i] / SHRAPNEL_Precision;
+		field_ydir[i] += gravity;
+		field_x[i] += field_xdir[i];
+		field_y[i] += field_ydir[i];
+
+		var end_x = field_x[i] / SHRAPNEL_Precision;
+		var end_y = field_y[i] / SHRAPNEL_Precision;
+		left = Min(left, Min(start_x[i], end_x));
+		top = Min(top, Min(start_y[i], end_y));
+		right = Max(right, Max(start_x[i], end_x));
+		bottom = Max(bottom, Max(start_y[i], end_y));
+	}
+
+	// Targets are searched once for all fragments
+	var targets = GetFragmentTargets(left, top, right, bottom);
+	ProfileCount("ShrapnelField::Targets", GetLength(targets));
+
+	var remaining = 0;
+	for (var i = 0; i < count; ++i)
+	{
+		var x1 = start_x[i], y1 = start_y[i];
+		var x2 = field_x[i] / SHRAPNEL_Precision, y2 = field_y[i] / SHRAPNEL_Precision;
+		var stopped = false;
+
+		// Landscape
+		var blocked = PathFree2(x1, y1, x2, y2);
+		if (blocked)
+		{
+			x2 = blocked[0];
+			y2 = blocked[1];
+			stopped = true;
+		}
+
+		// Targets before the landscape
+		var hit = GetFragmentHit(targets, x1, y1, x2, y2);
+		if (hit)
+		{
+			x2 = x1 + (x2 - x1) * hit.Entry / 1000;
+			y2 = y1 + (y2 - y1) * hit.Entry / 1000;
+			HitTarget(hit.Target);
+			stopped = true;
+		}
+
+		DrawFragmentTrail(x1, y1, x2, y2);
+
+		// Keep the fragment
+		if (!stopped && field_age < SHRAPNEL_Lifetime && x2 >= 0 && x2 < LandscapeWidth() && y2 < LandscapeHeight())
+		{
+			field_x[remaining] = field_x[i];
+			field_y[remaining] = field_y[i];
+			field_xdir[remaining] = field_xdir[i];
+			field_ydir[remaining] = field_ydir[i];
+			remaining += 1;
+		}
+	}
+	SetLength(field_x, remaining);
+	SetLength(field_y, remaining);
+	SetLength(field_xdir, remaining);
+	SetLength(field_ydir, remaining);
+
+	ProfileEnd("ShrapnelField::MoveFragments");
+	if (remaining == 0)
+	{
+		RemoveObject();
+	}
+}
+
+
+// Same criteria as the hit check of projectiles
+func GetFragmentTargets(int left, int top, int right, int bottom)
+{
+	var targets = [];
+	for (var target in FindObjects(Find_InRect(AbsX(left), AbsY(top), right - left + 1, bottom - top + 1),
+	                               Find_NoContainer(),
+	                               Find_Layer(field_layer),
+	                               Find_Or(Find_OCF(OCF_Alive), Find_Func("IsProjectileTarget", this, GetController()))))
+	{
+		var target_x = target->GetX() + target->GetDefOffset(0);
+		var target_y = target->GetY() + target->GetDefOffset(1);
+		PushBack(targets,
+		{
+			Target = target,
+			Left = target_x,
+			Top = target_y,
+			Right = target_x + target->GetDefWidth(),
+			Bottom = target_y + target->GetDefHeight(),
+		});
+	}
+	return targets;
+}
+
+
+// Gets the closest target on the line, and where the line enters it
+func GetFragmentHit(array targets, int x1, int y1, int x2, int y2)
+{
+	var hit;
+	for (var target in targets)
+	{
+		if (!target.Target) continue;
+
+		var entry = GetLineRectEntry(x1, y1, x2, y2, target.Left, target.Top, target.Right, target.Bottom);
+		if (entry != nil && (hit == nil || entry < hit.Entry))
+		{
+			hit = {Target = target.Target, Entry = entry};
+		}
+	}
+	return hit;
+}
+
+
+func HitTarget(object target)
+{
+	if (WeaponCanHit(target))
+	{
+		target->~OnProjectileHit(this);
+		WeaponDamage(target, field_damage, FX_Call_EngObjHit, true);
+	}
+}
+
+
+func DrawFragmentTrail(int x1, int y1, int x2, int y2)
+{
+	var x = AbsX((x1 + x2) / 2);
+	var y = AbsY((y1 + y2) / 2);
+	if (!RequestParticles("ShrapnelTrail", 1, PARTICLE_Priority_Low, x, y)) return;
+
+	var trail = GetParticleDefinition("ShrapnelTrail") ?? StoreParticleDefinition("ShrapnelTrail",
+	{
+		R = 255, G = 220, B = 160,
+		Size = SHRAPNEL_TrailLength,
+		Alpha = PV_Linear(160, 0),
+		BlitMode = GFX_BLIT_Additive,
+	});
+	CreateParticle("BulletTrace", x, y, 0, 0, 3, {Prototype = trail, Rotation = Angle(x1, y1, x2, y2)}, 1);
+}
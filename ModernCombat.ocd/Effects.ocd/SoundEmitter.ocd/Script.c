@@ -0,0 +1,48 @@
+/**
+	Sound emitter
+
+	Invisible object that plays sounds at a position.
+	Emitters are reused by Sound(..., {multiple = true}),
+	see System.ocg/Script_Sound.c
+ */
+
+/* --- Properties --- */
+
+local Visibility = VIS_All;
+
+local sound_free_frame; // The emitter can be moved to another position after this frame
+local sound_priority;   // Priority of the sound that the emitter plays
+
+/* --- Interface --- */
+
+public func IsSoundEmitter()
+{
+	return true;
+}
+
+
+public func IsSoundEmitterFree()
+{
+	return sound_free_frame == nil || FrameCounter() >= sound_free_frame;
+}
+
+
+public func GetSoundEmitterFreeFrame()
+{
+	return sound_free_frame ?? 0;
+}
+
+
+public func GetSoundEmitterPriority()
+{
+	return sound_priority;
+}
+
+
+// Moves the emitter to the position and keeps it there, so that the sound can finish playing
+public func ReserveSoundEmitter(int x, int y, int duration, int priority)
+{
+	SetPosition(x, y);
+	sound_free_frame = FrameCounter() + duration;
+	sound_priority = priority;
+}
@@ -0,0 +1,163 @@
+/**
+	Battlefield border manager
+
+	Keeps the areas of all battlefield border zones as plain rectangles.
+	Clonks are checked against these rectangles by a single tracker
+	effect per clonk, see BattlefieldBorder.fxbordertracker.
+
+	The manager exists only while there are zones. It is created with
+	the first zone and removes itself and the trackers with the last one.
+ */
+
+/* --- Properties --- */
+
+local Visibility = VIS_Editor;
+
+local border_zones; // The registered zone objects
+local zone_rects;   // Absolute rectangle, type and team of every zone
+
+/* --- Engine callbacks --- */
+
+func Initialize()
+{
+	if (ObjectCount(Find_ID(GetID())) > 1)
+	{
+		RemoveObject();
+		return;
+	}
+	border_zones = [];
+	zone_rects = [];
+
+	// Track clonks that existed before the first zone
+	for (var clonk in FindObjects(Find_Func("IsClonk")))
+	{
+		AddTracker(clonk);
+	}
+}
+
+
+func Destruction()
+{
+	// Clonks do not need the trackers without zones
+	for (var clonk in FindObjects(Find_Func("IsClonk")))
+	{
+		var tracker = GetEffect(BattlefieldBorder.fxbordertracker.Name, clonk);
+		if (tracker && tracker.manager == this) // A duplicate manager must not remove the trackers of the actual one
+		{
+			RemoveEffect(nil, clonk, tracker);
+		}
+	}
+}
+
+/* --- Interface --- */
+
+public func AddZone(object zone)
+{
+	if (GetType(this) == C4V_Def)
+	{
+		return GetManager()->AddZone(zone);
+	}
+	else
+	{
+		if (!IsValueInArray(border_zones, zone))
+		{
+			PushBack(border_zones, zone);
+		}
+		UpdateZoneRects();
+	}
+}
+
+
+public func RemoveZone(object zone)
+{
+	if (GetType(this) == C4V_Def)
+	{
+		var manager = FindObject(Find_ID(this));
+		if (manager)
+		{
+			manager->RemoveZone(zone);
+		}
+	}
+	else
+	{
+		RemoveArrayValue(border_zones, zone);
+		UpdateZoneRects();
+
+		// That was the last zone
+		if (GetLength(zone_rects) == 0)
+		{
+			RemoveObject();
+		}
+	}
+}
+
+
+// Called by a zone when its area, type, team or position changes
+public func OnZoneChanged(object zone)
+{
+	if (GetType(this) == C4V_Def)
+	{
+		var manager = FindObject(Find_ID(this));
+		if (manager)
+		{
+			manager->OnZoneChanged(zone);
+		}
+	}
+	else if (IsValueInArray(border_zones, zone))
+	{
+		UpdateZoneRects();
+	}
+}
+
+
+// Adds the tracker effect to a clonk, but only if there are zones, that is if the manager exists
+public func AddTracker(object clonk)
+{
+	if (GetType(this) == C4V_Def)
+	{
+		var manager = FindObject(Find_ID(this));
+		if (manager)
+		{
+			manager->AddTracker(clonk);
+		}
+	}
+	else if (!GetEffect(BattlefieldBorder.fxbordertracker.Name, clonk))
+	{
+		clonk->CreateEffect(BattlefieldBorder.fxbordertracker, 1, 1, this);
+	}
+}
+
+
+public func GetZoneRects()
+{
+	return zone_rects;
+}
+
+/* --- Internals --- */
+
+func UpdateZoneRects()
+{
+	zone_rects = [];
+	for (var zone in border_zones)
+	{
+		if (zone)
+		{
+			PushBack(zone_rects, zone->GetZoneRect());
+		}
+	}
+}
+
+
+func GetManager()
+{
+	AssertDefinitionContext();
+	var manager = FindObject(Find_ID(this));
+	if (manager)
+	{
+		return manager;
+	}
+	else
+	{
+		return CreateObject(this);
+	}
+}
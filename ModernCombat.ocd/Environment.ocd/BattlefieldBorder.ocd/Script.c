@@ -17,116 +17,156 @@ static const ZONETYPE_INSTANTDEATH = 2;
 
 /* --- Functionality --- */
 
-// Effect for zone checks
-local fxzonecheck = new Effect
+// Effect applied to every clonk, checks the clonk position against all zones
+local fxbordertracker = new Effect
 {
-	Timer = func()
+	Name = "BattlefieldBorderTracker",
+
+	MaxAreaTime = 35 * 10, // 35 Frames per second * 10 Seconds
+
+	manager = nil,      // The border manager with the zone rectangles
+	zoneobject = nil,   // The zone that the target has entered
+	zone_entered = 0,   // Effect time when the target entered that zone
+
+	Start = func (int temp, object border_manager)
 	{
-		var objs;
+		if (!temp)
+		{
+			manager = border_manager;
+		}
+	},
 
-		if (Target.zonetype == ZONETYPE_NORMAL)
+	Timer = func (int time)
+	{
+		if (!manager)
 		{
-			// Outside Battlefield. Find everything that is in this area.
-			objs = Target->FindObjects(Target->Find_InZone(), Target->Find_Target());
+			return FX_Execute_Kill;
+		}
 
-			for (var obj in objs)
-			{
-				if (!GetEffect("DeathZoneTimer", obj)) obj->CreateEffect(Target.fxinsidedeathzone,1,1, { zoneobj = Target } );
-			}
+		// Dead or respawning targets are not affected by the zones
+		if (!Target->GetAlive() || Target->~IsRespawning())
+		{
+			this->LeaveZone();
+			return FX_OK;
 		}
-		else if (Target.zonetype == ZONETYPE_TEAMSPAWN)
+
+		var x = Target->GetX();
+		var y = Target->GetY();
+		var still_inside = false;
+		var entered = nil;
+		for (var zone in manager->GetZoneRects())
 		{
-			// Team Spawn. Find everything but clonks from the specified team.
-			objs = Target->FindObjects(Target->Find_InZone(), Target->Find_Target(), Find_Not(Find_Team(Target.team)));
+			if (x < zone.left || x >= zone.right || y < zone.top || y >= zone.bottom)
+			{
+				continue;
+			}
 
-			for (var obj in objs)
+			if (zone.type == ZONETYPE_INSTANTDEATH)
 			{
-				if (!GetEffect("DeathZoneTimer", obj)) obj->CreateEffect(Target.fxinsidedeathzone,1,1, { zoneobj = Target } );
+				// Instant Death Zone. Kill everything instantaneously in this area.
+				// TODO: Maybe adjust killtracing if needed
+				Target->Kill();
+				this->LeaveZone();
+				return FX_OK;
+			}
+			else if (zone.type == ZONETYPE_TEAMSPAWN && GetPlayerTeam(Target->GetOwner()) == zone.team)
+			{
+				// Team Spawn. Does not affect clonks from the specified team.
+				continue;
 			}
-		}
-		else if (Target.zonetype == ZONETYPE_INSTANTDEATH)
-		{
-			// Instant Death Zone. Kill everything instantaneously in this area.
-			objs = Target->FindObjects(Target->Find_InZone(), Target->Find_Target());
 
-			// TODO: Maybe adjust killtracing if needed
-			for (var obj in objs)
+			if (zone.border == zoneobject)
 			{
-				obj->Kill(); // Kill clonk
+				still_inside = true;
 			}
+			entered = entered ?? zone.border;
 		}
-	}
-};
-
-
-// Effect applied to clonks that entered a death zone
-local fxinsidedeathzone = new Effect
-{
-	Name = "DeathZoneTimer",
-
-	MaxAreaTime = 35 * 10, // 35 Frames per second * 10 Seconds
-
-	zoneobject = nil,
 
-	Start = func(temp, params)
-	{
-		zoneobject = params.zoneobj;
-	},
-
-	Timer = func()
-	{
-		// Remove effect from dead or respawning targets
-		if (!Target->GetAlive() || Target->~IsRespawning())
+		if (zoneobject)
 		{
-			return FX_Execute_Kill;
-		}
+			// Leaving the area resets the countdown
+			if (!still_inside)
+			{
+				this->LeaveZone();
+				return FX_OK;
+			}
 
+			// Show remaining time
+			var area_time = time - zone_entered;
+			Target->PlayerMessage(Target->GetOwner(), "$GoBack$", (MaxAreaTime - area_time) / 35);
 
-		// Remove Effect if clonk leaves the area
-		// The combination of Find_Not and Find_Exclude reduces the possible objects to find to just the clonk. We only want to check for this clonk if it's still inside the area.
-		// If we can't find it here, it has moved out of the area.
-		if (!zoneobject->FindObject(Find_Not(Find_Exclude(Target)), zoneobject->Find_InZone()))
+			if (area_time > MaxAreaTime)
+			{
+				// TODO: Maybe adjust killtracing if needed
+				Target->Kill();
+			}
+		}
+		else if (entered)
 		{
-			return FX_Execute_Kill;
+			// Countdown starts with the next timer call
+			zoneobject = entered;
+			zone_entered = time;
 		}
+		return FX_OK;
+	},
 
-		// Show remaining time
-		Target->PlayerMessage(Target->GetOwner(), "$GoBack$", (MaxAreaTime - Time) / 35);
-
-		if (Time > MaxAreaTime)
+	LeaveZone = func ()
+	{
+		if (zoneobject && Target)
 		{
-			// TODO: Maybe adjust killtracing if needed
-			Target->Kill();
+			Target->PlayerMessage(Target->GetOwner(), "");
 		}
+		zoneobject = nil;
 	},
 
 	Stop = func (int temp)
 	{
-		if (!temp && Target)
+		if (!temp)
 		{
-			Target->PlayerMessage(Target->GetOwner(), "");
+			this->LeaveZone();
 		}
 	},
 };
 
 
-func Find_InZone()
+// Absolute area of this zone, for the border manager
+public func GetZoneRect()
 {
-	return Find_InRect(area[0], area[1], area[2], area[3]);
+	var left = GetX() + area[0];
+	var top = GetY() + area[1];
+	return {
+		border = this,
+		left = left,
+		top = top,
+		right = left + area[2],
+		bottom = top + area[3],
+		type = zonetype,
+		team = team,
+	};
 }
 
 
-func Find_Target()
+/* --- Engine callbacks --- */
+
+
+func Initialize()
 {
-	return Find_And(Find_Func("IsClonk"), Find_Func("GetAlive"), Find_Not(Find_Func("IsRespawning")));
+	BattlefieldBorderManager->AddZone(this);
 }
 
-/* --- Engine callbacks --- */
 
+func Destruction()
+{
+	BattlefieldBorderManager->RemoveZone(this);
+	_inherited(...);
+}
 
-func Initialize()
+
+public func SetPosition(int x, int y, bool check_bounds)
 {
-	CreateEffect(fxzonecheck,1,1);
+	var result = inherited(x, y, check_bounds, ...);
+	BattlefieldBorderManager->OnZoneChanged(this);
+	return result;
 }
 
 
@@ -181,6 +221,7 @@ func Definition(def)
 func SetAreaRect(array new_area_rect)
 {
 	area = new_area_rect;
+	BattlefieldBorderManager->OnZoneChanged(this);
 	return true;
 }
 
@@ -193,6 +234,7 @@ func SetZoneType(int new_type)
 	var gfxnames = ["", "TeamSpawn", "Death"];
 	SetGraphics(gfxnames[new_type]);
 
+	BattlefieldBorderManager->OnZoneChanged(this);
 	return true;
 }
 
@@ -200,6 +242,7 @@ func SetZoneType(int new_type)
 func SetTeam(int new_team)
 {
 	team = new_team;
+	BattlefieldBorderManager->OnZoneChanged(this);
 	return true;
 }
 
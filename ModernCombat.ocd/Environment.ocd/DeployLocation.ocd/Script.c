@@ -184,7 +184,7 @@ public func IsFulfilled(array to_be_fulfilled, int player)
 {
 	for (var condition in to_be_fulfilled ?? [])
 	{
-		var fulfilled = DoCallback(condition, player);
+		var fulfilled = InvokeCallback(condition, player);
 		if (!fulfilled)
 			return false;
 	}
@@ -112,8 +112,9 @@ func EvaluateProgress()
 		FatalError("Hold the Flag goal has no flag, will remove the object");
 	}
 
+	// The flag post manager counts the controlled flag posts, there is only one flag post in this goal
 	var faction = GetFlag()->GetTeam();
-	if (faction != nil && GetFlag()->IsFullyCaptured())
+	if (faction != nil && CMC_FlagPostManager->HasFullControl(faction))
 	{
 		score_progress += 1;
 		if (score_progress >= 100)
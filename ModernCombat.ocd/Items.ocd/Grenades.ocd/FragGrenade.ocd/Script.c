@@ -19,8 +19,7 @@ public func OnDetonation()
 {
 	// Fragments
 	var level = 30;
-	DoShockwave(GetX(), GetY(), level, GetController(), GetObjectLayer());
-	ExplosionEffect(level, 0, 0, 0, true, level);
+	EnqueueBlast(nil, level, 0, level, true);
 
 	// Determine free angles
 	var angles = GetPathFreeAngles(level);
@@ -33,16 +32,17 @@ public func OnDetonation()
 	var pos_angle = (max_angle + avg_angle) / 2;
 
 	// Cast shrapnel in 3 cones, preferrably sideways
+	var field = CMC_Effect_ShrapnelField->Create(this, this->ShrapnelDamage());
 	var shrapnel_count = 40;
 	var spread = 5;
-	LaunchShrapnel(min_angle, neg_angle, spread, 2 * shrapnel_count / 5);
-	LaunchShrapnel(neg_angle, pos_angle, spread, 1 * shrapnel_count / 5);
-	LaunchShrapnel(pos_angle, max_angle, spread, 2 * shrapnel_count / 5);
+	LaunchShrapnel(field, min_angle, neg_angle, spread, 2 * shrapnel_count / 5);
+	LaunchShrapnel(field, neg_angle, pos_angle, spread, 1 * shrapnel_count / 5);
+	LaunchShrapnel(field, pos_angle, max_angle, spread, 2 * shrapnel_count / 5);
 
 	RemoveObject();
 }
 
-func LaunchShrapnel(int min_angle, int max_angle, int spread, int amount)
+func LaunchShrapnel(object field, int min_angle, int max_angle, int spread, int amount)
 {
 	var min = Min(min_angle, max_angle);
 	var max = Max(min_angle, max_angle);
@@ -51,12 +51,7 @@ func LaunchShrapnel(int min_angle, int max_angle, int spread, int amount)
 
 	for (var angle = min; amount > 0; --amount)
 	{
-		var shrapnel = CreateObject(Shrapnel, 0, 0, NO_OWNER);
-		shrapnel->SetVelocity(angle + RandomX(-spread, +spread), RandomX(70, 100));
-		shrapnel->SetRDir(RandomX(-30, +30));
-		shrapnel->Launch(GetController());
-		shrapnel.ProjectileDamage = this.ShrapnelDamage;
-		CreateObject(BulletTrail)->Set(shrapnel, 2, 30);
+		field->AddFragment(angle + RandomX(-spread, +spread), RandomX(70, 100));
 
 		/*
 		var frag = CreateObject(CMC_Projectile_Bullet); // FIXME: Lazy again :) But seriously, the fragment code is loooong
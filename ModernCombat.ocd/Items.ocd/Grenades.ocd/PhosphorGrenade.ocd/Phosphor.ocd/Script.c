@@ -195,6 +195,9 @@ func AttachTargetLost()
 
 func FireParticles()
 {
+	var amount = RequestParticles("PhosphorFire", 6, PARTICLE_Priority_Low); // Both particle types together
+	if (amount <= 0) return;
+
 	var light = RandomX(50, 150);
 	var fire = 
 	{
@@ -211,6 +214,6 @@ func FireParticles()
 		OnCollision = PC_Die(),
 		Attach = nil
 	};
-	CreateParticle("BlueFire", PV_Random(-2, +2), PV_Random(0, -2), PV_Random(-3, 3), PV_Random(-5, -15), PV_Random(5, 20), fire, 3);
-	CreateParticle("BlueFire", PV_Random(-2, +2), PV_Random(0, -2), PV_Random(-5, 5), PV_Random(-1, -10), PV_Random(5, 10), fire, 3);
+	CreateParticle("BlueFire", PV_Random(-2, +2), PV_Random(0, -2), PV_Random(-3, 3), PV_Random(-5, -15), PV_Random(5, 20), fire, (amount + 1) / 2);
+	CreateParticle("BlueFire", PV_Random(-2, +2), PV_Random(0, -2), PV_Random(-5, 5), PV_Random(-1, -10), PV_Random(5, 10), fire, amount / 2);
 }
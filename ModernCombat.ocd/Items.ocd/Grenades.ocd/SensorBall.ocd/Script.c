@@ -47,7 +47,7 @@ func PlaySoundDetonation()
 
 func PlaySoundHit()
 {
-	Sound("Items::Tools::BoobyTrap::Hit?", {multiple = true});
+	Sound("Items::Tools::BoobyTrap::Hit?", {multiple = true, priority = SOUND_Priority_High});
 }
 
 /* --- Engine callback --- */
@@ -118,6 +118,7 @@ func Sense ()
 	{
 		return RemoveObject();
 	}
+	ProfileBegin("SensorBall::Sense");
 
 	var menaces = FindObjects(Find_Distance(Sensor_Distance),
                                   Find_Exclude(this),
@@ -143,6 +144,8 @@ func Sense ()
 			}
 		}
 	}
+	ProfileCount("SensorBall::Menaces", GetLength(menaces));
+	ProfileEnd("SensorBall::Sense");
 }
 
 
@@ -33,7 +33,7 @@ func PlaySoundDetonation()
 
 func PlaySoundHit()
 {
-	Sound("Items::Grenades::SmokeGrenade::Hit?", {multiple = true});
+	Sound("Items::Grenades::SmokeGrenade::Hit?", {multiple = true, priority = SOUND_Priority_High});
 }
 
 /* --- Overloads --- */
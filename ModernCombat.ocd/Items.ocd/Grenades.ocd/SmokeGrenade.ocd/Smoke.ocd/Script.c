@@ -72,6 +72,8 @@ func DoSmoke(int time)
 {
 	var some_value = (time - fadetime) * 255 / CMC_SmokeGrenade_FadeTime;
 	var alpha = 255 - BoundBy(some_value, 0, 255);
+	// The smoke hides what is behind it, so it is always created
+	if (!RequestParticles("GrenadeSmoke", 1, PARTICLE_Priority_High)) return;
 	CreateParticle("Smoke", 0, -smoke_size / 5, PV_Random(-20, 20), PV_Random(-10, +10), 85, {Prototype = CMC_Grenade_Smoke->Particles_GrenadeSmoke(5, smoke_size * 2), Alpha = PV_Linear(alpha, 0), });
 }
 
@@ -30,7 +30,7 @@ func PlaySoundDetonation()
 
 func PlaySoundHit()
 {
-	Sound("Items::Grenades::StunGrenade::Hit?", {multiple = true});
+	Sound("Items::Grenades::StunGrenade::Hit?", {multiple = true, priority = SOUND_Priority_High});
 }
 
 func PlaySoundFlashbang(object target)
@@ -48,7 +48,10 @@ func OnDetonation()
 	var full_range = this.Grenade_Radius;
 	var short_range = full_range / 5;
 
-	var targets = FindObjects(Find_Distance(full_range), Find_Func(GetFunctionName(CMC_Library_AffectedByStunGrenade.IsAffectedByStunGrenade), this, full_range, short_range));
+	// Visibility is determined once for all targets
+	var profile = GetVisibilityProfile(full_range, nil, -4);
+
+	var targets = FindObjects(Find_Distance(full_range), Find_Func(GetFunctionName(CMC_Library_AffectedByStunGrenade.IsAffectedByStunGrenade), this, full_range, short_range, profile));
 	for (var target in targets)
 	{
 		// Targets in helicopters can be blinded (TODO: Replace this by better criteria!)
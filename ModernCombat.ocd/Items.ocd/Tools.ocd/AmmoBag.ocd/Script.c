@@ -146,8 +146,8 @@ public func GetListSelectionMenuEntries(object user, string type, proplist main_
 		var default_action = "$Cancel$";
 		default_entry->SetIcon(Icon_Cancel)
 			         ->SetCaption(default_action)
-			         ->SetCallbackOnClick(DefineCallback(this.CloseListSelectionMenu))
-			         ->SetCallbackOnMouseIn(ammo_list->DefineCallback(ammo_list.SelectEntry, default_action))
+			         ->SetCallbackOnClick(BindCallback(this.CloseListSelectionMenu))
+			         ->SetCallbackOnMouseIn(ammo_list->BindCallback(ammo_list.SelectEntry, default_action))
 			         ->SetScrollHint(true);
 		ammo_list->AddEntry(default_action, default_entry);
 		this->~SetListSelectionMenuHotkey(default_entry, 9);
@@ -184,8 +184,8 @@ public func GetListSelectionMenuEntries(object user, string type, proplist main_
 			entry->SetIcon(ammo_type)
 			     ->SetCaption(name)
 			     ->SetCount(ammo_info.ammo_count)
-			     ->SetCallbackOnClick(DefineCallback(call_on_click, user, ammo_type))
-			     ->SetCallbackOnMouseIn(ammo_list->DefineCallback(ammo_list.SelectEntry, ammo_type))
+			     ->SetCallbackOnClick(BindCallback(call_on_click, user, ammo_type))
+			     ->SetCallbackOnMouseIn(ammo_list->BindCallback(ammo_list.SelectEntry, ammo_type))
 			     ->SetScrollHint(true);
 			ammo_list->AddEntry(ammo_type, entry);
 			SetListSelectionMenuHotkey(entry, hotkey++);
@@ -492,14 +492,10 @@ func Detonate()
 	if (GetAction() == "Active")
 	{
 		var spread = BoobyTrapExplosionAngle;
+		var field = CMC_Effect_ShrapnelField->Create(this, ShrapnelDamage());
 		for (var amount = 12; amount > 0; --amount)
 		{
-			var shrapnel = CreateObject(Shrapnel, 0, 0, NO_OWNER);
-			shrapnel->SetVelocity(GetR() + booby_trap_aim_angle + RandomX(-spread, +spread), RandomX(100, 180));
-			shrapnel->SetRDir(RandomX(-30, +30));
-			shrapnel->Launch(GetController());
-			shrapnel.ProjectileDamage = this.ShrapnelDamage;
-			CreateObject(BulletTrail)->Set(shrapnel, 2, 30);
+			field->AddFragment(GetR() + booby_trap_aim_angle + RandomX(-spread, +spread), RandomX(100, 180));
 		}
 		ExplosionEffect(10);
 	}
@@ -130,10 +130,10 @@ func UseOn(object user, object target)
 	{
 		user->PlayerMessage(user->GetOwner(), reject);
 	}
-	else if (target->Heal(this.HealAmount, this.HealInterval, true, true, GetID()->DefineCallback(this.HealEffect)))
+	else if (target->Heal(this.HealAmount, this.HealInterval, true, true, GetID()->StaticCallback(this.HealEffect)))
 	{
 		PlaySoundInject(target);
-		target->CreateEffect(FxFlashScreenRGBa, 200, 1, this.HealEffectLayer, this.HealEffectColor, 180, 35);
+		target->FlashScreen(this.HealEffectLayer, this.HealEffectColor, 180, 35);
 
 	    if ((user != target)
 	     && (!Hostile(user->GetOwner(), target->GetOwner())))
@@ -165,7 +165,7 @@ func HealEffect(object target, int time)
 
 	if(0 == (time % 18))
 	{
-		target->CreateEffect(FxFlashScreenRGBa, 200, 1, this.HealEffectLayer, this.HealEffectColor, 80, 30);
+		target->FlashScreen(this.HealEffectLayer, this.HealEffectColor, 80, 30);
 	}
 }
 
@@ -39,3 +39,312 @@ public func HasAbility(id ability)
 	}
 	return false;
 }
+
+/* --- Loadout --- */
+
+static cmc_class_loadouts; // Loadout templates, by class definition, see GetClassLoadout()
+
+/**
+	Gets the equipment of the class in a form that can be handed
+	out without further lookups.
+
+	The template is compiled once per class and is shared by all
+	crew members, so it must not be modified.
+
+	@return proplist The template:
+	                 {@code Ammo} and {@code Grenades} are arrays of {Type = definition, Amount = amount},
+	                 {@code Items} is an array of item definitions, one entry per item.
+ */
+public func GetClassLoadout()
+{
+	var key = Format("%i", this);
+	cmc_class_loadouts = cmc_class_loadouts ?? {};
+	if (!cmc_class_loadouts[key])
+	{
+		cmc_class_loadouts[key] = CompileClassLoadout();
+	}
+	return cmc_class_loadouts[key];
+}
+
+
+func CompileClassLoadout()
+{
+	var loadout = {Ammo = [], Items = [], Grenades = []};
+	for (var ammo_type in GetProperties(this.Ammo))
+	{
+		PushBack(loadout.Ammo, {Type = GetDefinition(ammo_type), Amount = this.Ammo[ammo_type]});
+	}
+	// Different logic necessary, because the properties are sorted alphabetically
+	for (var item_type in GetProperties(this.Items))
+	{
+		for (var amount = this.Items[item_type].Amount; amount > 0; --amount)
+		{
+			PushBack(loadout.Items, this.Items[item_type].Type);
+		}
+	}
+	for (var grenade_type in GetProperties(this.Grenades))
+	{
+		PushBack(loadout.Grenades, {Type = GetDefinition(grenade_type), Amount = this.Grenades[grenade_type]});
+	}
+	return loadout;
+}
+
+/* --- Respawn menu --- */
+
+static cmc_class_tab_layouts; // Layouts of the class tabs, by class definition, see GetClassTabLayout()
+
+/**
+	Gets the layout for the class tab in the respawn menu.
+
+	The layout is assembled once per class and is shared by all menus,
+	so it must not be modified. Use CopyClassTabLayout() for adding
+	its properties as sub windows of a GUI element.
+
+	@return proplist The sub windows: description, ammo, abilities, items, grenades.
+ */
+public func GetClassTabLayout()
+{
+	var key = Format("%i", this);
+	cmc_class_tab_layouts = cmc_class_tab_layouts ?? {};
+	if (!cmc_class_tab_layouts[key])
+	{
+		cmc_class_tab_layouts[key] = AssembleClassTabLayout();
+	}
+	return cmc_class_tab_layouts[key];
+}
+
+
+/**
+	Gets a copy of the layout for the class tab in the respawn menu,
+	that can be added to a GUI element. Copying is cheaper than
+	assembling the layout, and changes of the GUI element do not
+	reach the shared layout.
+
+	@return proplist The sub windows, see GetClassTabLayout().
+ */
+public func CopyClassTabLayout()
+{
+	return CopyClassTabWindow(GetClassTabLayout());
+}
+
+
+func CopyClassTabWindow(proplist window)
+{
+	var copy = {};
+	for (var property in GetProperties(window))
+	{
+		var value = window[property];
+		if (GetType(value) == C4V_PropList)
+		{
+			value = CopyClassTabWindow(value);
+		}
+		else if (GetType(value) == C4V_Array)
+		{
+			value = value[:];
+		}
+		copy[property] = value;
+	}
+	return copy;
+}
+
+
+func AssembleClassTabLayout()
+{
+	var layout = {};
+	var icon_size = GuiDimensionCmc(nil, GUI_CMC_Element_Icon_Size);
+	var row_height = GuiDimensionCmc(nil, GUI_CMC_Element_Icon_Size + GUI_CMC_Margin_Element_V);
+
+	// Description box
+	if (this.Description)
+	{
+		layout.description =
+		{
+			Priority = 1,
+			Bottom = GuiDimensionCmc(200)->ToString(),
+
+			icon =  // Display icon and then transparent background with text, because text will be easier to read
+			{
+				Bottom = GuiDimensionCmc(1000, -GUI_CMC_Margin_Element_V)->ToString(),
+				Symbol = this,
+
+				desc =
+				{
+					Style = GUI_TextHCenter | GUI_TextVCenter,
+					Text = this.Description,
+					BackgroundColor = GUI_CMC_Background_Color_Default,
+				},
+			},
+		};
+	}
+
+	// Ammo
+	if (this.Ammo)
+	{
+		layout.ammo =
+		{
+			Priority = 2,
+			Bottom = row_height->ToString(),
+
+			box = 
+			{
+				BackgroundColor = GUI_CMC_Background_Color_Default,
+				Bottom = icon_size->ToString(),
+				Style = GUI_GridLayout,
+			}
+		};
+		var ammo_types = GetProperties(this.Ammo);
+		var index = 0;
+		for (var ammo_type in ammo_types)
+		{
+			var ammo = GetDefinition(ammo_type);
+			layout.ammo.box[ammo_type] = AssembleClassTabAmmoIcon(index++, ammo, this.Ammo[ammo_type], icon_size);
+			index += 1;
+		}
+	}
+
+	// Abilities
+	if (this.Abilities && GetLength(this.Abilities) > 0)
+	{
+		layout.abilities =
+		{
+			Priority = 3,
+			Bottom = row_height->ToString(),
+
+			box = 
+			{
+				BackgroundColor = GUI_CMC_Background_Color_Default,
+				Bottom = icon_size->ToString(),
+				Style = GUI_GridLayout,
+			}
+		};
+		var index = 0;
+		for (var ability in this.Abilities)
+		{
+			layout.abilities.box[Format("%i", ability)] = AssembleClassTabAbilityIcon(index++, ability, icon_size);
+		}
+	}
+
+	// Weapons
+	if (this.Items)
+	{
+		var item_types = GetProperties(this.Items);
+		var size = icon_size->Scale(GetLength(item_types));
+		layout.items =
+		{
+			Priority = 4,
+			Bottom = size->Add(GuiDimensionCmc(nil, GUI_CMC_Margin_Element_V))->ToString(),
+
+			list = 
+			{
+				BackgroundColor = GUI_CMC_Background_Color_Default,
+				Bottom = size->ToString(),
+				Style = GUI_VerticalLayout,
+			}
+		};
+		var index = 0;
+		for (var item_type in item_types)
+		{
+			var item = this.Items[item_type].Type;
+			layout.items.list[item_type] = AssembleClassTabInventoryIcon(index++, item, this.Items[item_type].Amount, icon_size);
+		}
+	}
+
+	// Grenades
+	if (this.Grenades)
+	{
+		var grenade_types = GetProperties(this.Grenades);
+		var size = icon_size->Scale(GetLength(grenade_types));
+		layout.grenades =
+		{
+			Priority = 5,
+			Bottom = size->Add(GuiDimensionCmc(nil, GUI_CMC_Margin_Element_V))->ToString(),
+
+			list = 
+			{
+				BackgroundColor = GUI_CMC_Background_Color_Default,
+				Bottom = size->ToString(),
+				Style = GUI_VerticalLayout,
+			}
+		};
+		var index = 0;
+		for (var grenade_type in grenade_types)
+		{
+			var grenade = GetDefinition(grenade_type);
+			layout.grenades.list[grenade_type] = AssembleClassTabInventoryIcon(index++, grenade, this.Grenades[grenade_type], icon_size);
+		}
+	}
+	return layout;
+}
+
+
+// For respawn menu
+func AssembleClassTabAbilityIcon(int priority, id ability, proplist icon_size)
+{
+	return
+	{
+		Priority = priority,
+		Tooltip = ability.Description,
+
+		icon = 
+		{
+			Right = icon_size->ToString(),
+			Bottom = icon_size->ToString(),
+			Symbol = ability,
+		},
+
+		label = 
+		{
+			Left = icon_size->Add(GuiDimensionCmc(nil, GUI_CMC_Margin_Element_Small_H))->ToString(),
+			Style = GUI_TextVCenter,
+			Text = ability->GetName(),
+		},
+	};
+}
+
+// For respawn menu
+func AssembleClassTabAmmoIcon(int priority, id ammo, int amount, proplist icon_size)
+{
+	return
+	{
+		Priority = priority,
+		Right = icon_size->ToString(),
+		Bottom = icon_size->ToString(),
+
+		Symbol = ammo,
+		Text = Format("%dx", amount),
+		Tooltip = ammo->GetName(),
+		Style = GUI_TextBottom | GUI_TextRight,
+	};
+}
+
+// For respawn menu
+func AssembleClassTabInventoryIcon(int priority, id item, int amount, proplist icon_size)
+{
+	return
+	{
+		Priority = priority,
+		Tooltip = item.Description,
+
+		Bottom = icon_size->ToString(),
+
+		icon = 
+		{
+			Right = icon_size->ToString(),
+			Bottom = icon_size->ToString(),
+			Symbol = item,
+
+			count = 
+			{			
+				Text = Format("%dx", amount),
+				Style = GUI_TextBottom | GUI_TextRight,
+			},
+		},
+
+		label = 
+		{
+			Left = icon_size->Add(GuiDimensionCmc(nil, GUI_CMC_Margin_Element_Small_H))->ToString(),
+			Style = GUI_TextVCenter,
+			Text = item->GetName(),
+		},
+	};
+}
@@ -8,7 +8,11 @@
 
 /* --- Properties --- */
 
+static const CMC_CREW_LoadoutPerStep = 1; // Prepare this many items per call of PrepareCrewLoadout()
+
 local cmc_crew_class = nil;
+local cmc_crew_loadout = nil; // Items that were prepared during the relaunch countdown
+local cmc_crew_loadout_batch = nil; // HUD notifications that were held back while the loadout is created
 
 /* --- Class system interface --- */
 
@@ -35,262 +39,212 @@ public func OnCrewRelaunchFinish()
 {
 	_inherited(...);
 
-	// Create ammo
-	var ammo_types = GetProperties(GetCrewClass().Ammo);
-	for (var ammo_type in ammo_types)
-	{
-		var ammo = GetDefinition(ammo_type);
-		var amount = GetCrewClass().Ammo[ammo_type];
-		this->SetAmmo(ammo, amount);
-	}
+	MaterializeCrewLoadout(GetCrewClass()->GetClassLoadout());
+}
 
-	// Create contents - different logic necessary, because the properties are sorted alphabetically
-	var item_types = GetProperties(GetCrewClass().Items);
-	for (var item_type in item_types)
-	{
-		var item = GetCrewClass().Items[item_type].Type;
-		var amount = GetCrewClass().Items[item_type].Amount;
-		CreateContents(item, amount);
-	}
 
-	// Create grenades
-	var grenade_types = GetProperties(GetCrewClass().Grenades);
-	for (var grenade_type in grenade_types)
+public func OnInventoryChange()
+{
+	if (cmc_crew_loadout_batch)
 	{
-		var amount = GetCrewClass().Grenades[grenade_type];
-		this->~DoGrenadeCount(grenade_type, amount);
+		cmc_crew_loadout_batch.Inventory = true;
+		return;
 	}
-	// Set the one with the most count active
-	this->~GetCurrentGrenadeType();
+	return _inherited(...);
 }
 
-/* --- Callbacks from respawn system --- */
 
-public func OnOpenRespawnMenu(proplist menu)
+public func OnSlotObjectChanged(int slot)
 {
-	_inherited(menu, ...);
-
-	// Add class selection tabs
-	for (var class in this->GetAvailableClasses())
+	if (cmc_crew_loadout_batch)
 	{
-		menu->GetTabs()->AddTab(class,                                               // identifier
-		                        class->~GetName(),                                   // label text
-		                        DefineCallback(this.OnSelectClassTab, menu, class)); // called on button click
+		PushBack(cmc_crew_loadout_batch.Slots, slot);
+		return;
 	}
-	menu->GetTabs()->SelectTab();
+	return _inherited(slot, ...);
 }
 
-public func OnSelectClassTab(proplist menu, id class)
+
+func Destruction()
 {
-	// Update the class
-	SetCrewClass(class);
+	DiscardCrewLoadout();
+	_inherited(...);
+}
 
-	// Update the contents box
-	menu->ResetContentBox();
+/* --- Loadout --- */
+
+/**
+	Hands out the equipment of a loadout template.
 
-	// --- Actual contents
+	The HUD is notified once at the end, not for every item.
 
-	var icon_size = GuiDimensionCmc(nil, GUI_CMC_Element_Icon_Size);
+	@par loadout The template, see {@link CMC_Library_Class#GetClassLoadout}.
+ */
+public func MaterializeCrewLoadout(proplist loadout)
+{
+	ProfileBegin("ClassSystem::MaterializeCrewLoadout");
+	cmc_crew_loadout_batch = {Inventory = false, Slots = []};
 
-	// Description box
-	if (class.Description)
+	// Ammo
+	for (var ammo in loadout.Ammo)
 	{
-		var description = new GUI_Element
-		{
-			Priority = 1,
-
-			icon =  // Display icon and then transparent background with text, because text will be easier to read
-			{
-				Bottom = GuiDimensionCmc(1000, -GUI_CMC_Margin_Element_V)->ToString(),
-				Symbol = class,
-
-				desc =
-				{
-					Style = GUI_TextHCenter | GUI_TextVCenter,
-					Text = class.Description,
-					BackgroundColor = GUI_CMC_Background_Color_Default,
-				},
-			},
-		};
-		description->SetHeight(200)->AddTo(menu->GetContentBox());
+		this->SetAmmo(ammo.Type, ammo.Amount);
 	}
 
-	// Ammo
-	if (class.Ammo)
+	// Contents, unless they were prepared already
+	if (!TakeCrewLoadout())
 	{
-		var ammo_info = new GUI_Element 
-		{
-			Priority = 2,
-
-			box = 
-			{
-				BackgroundColor = GUI_CMC_Background_Color_Default,
-				Bottom = icon_size->ToString(),
-				Style = GUI_GridLayout,
-			}
-		};
-		var ammo_types = GetProperties(class.Ammo);
-		var index = 0;
-		for (var ammo_type in ammo_types)
+		for (var item in loadout.Items)
 		{
-			var ammo = GetDefinition(ammo_type);
-			ammo_info.box[ammo_type] = AssembleClassTabAmmoIcon(index++, ammo, class.Ammo[ammo_type], icon_size);
-			index += 1;
+			CreateContents(item);
 		}
-		ammo_info->SetHeight(GuiDimensionCmc(nil, GUI_CMC_Element_Icon_Size + GUI_CMC_Margin_Element_V))
-		         ->AddTo(menu->GetContentBox());
 	}
 
-	// Abilities
-	if (class.Abilities && GetLength(class.Abilities) > 0)
+	// Grenades, the one with the most count is active
+	for (var grenade in loadout.Grenades)
 	{
-		var ability_info = new GUI_Element 
-		{
-			Priority = 3,
-
-			box = 
-			{
-				BackgroundColor = GUI_CMC_Background_Color_Default,
-				Bottom = icon_size->ToString(),
-				Style = GUI_GridLayout,
-			}
-		};
+		this->~DoGrenadeCount(grenade.Type, grenade.Amount);
+	}
+	this->~GetCurrentGrenadeType();
 
-		var index = 0;
-		for (var ability in class.Abilities)
+	// Notify the HUD
+	var batch = cmc_crew_loadout_batch;
+	cmc_crew_loadout_batch = nil;
+	for (var i = 0; i < GetLength(batch.Slots); ++i)
+	{
+		if (GetIndexOf(batch.Slots, batch.Slots[i]) == i)
 		{
-			ability_info.box[Format("%i", ability)] = AssembleClassTabAbilityIcon(index++, ability, icon_size);
+			this->~OnSlotObjectChanged(batch.Slots[i]);
 		}
+	}
+	if (batch.Inventory)
+	{
+		this->~OnInventoryChange();
+	}
+	var hud = this->~GetHUDController();
+	if (hud && GetLength(loadout.Ammo) > 0)
+	{
+		hud->~OnAmmoChange(this);
+	}
+	ProfileEnd("ClassSystem::MaterializeCrewLoadout");
+}
 
-		ability_info->SetHeight(GuiDimensionCmc(nil, GUI_CMC_Element_Icon_Size + GUI_CMC_Margin_Element_V))
-		            ->AddTo(menu->GetContentBox());
 
-	}
+/**
+	Find out whether the HUD notifications are held back,
+	because the loadout is being created.
+ */
+public func IsMaterializingCrewLoadout()
+{
+	return cmc_crew_loadout_batch != nil;
+}
+
+
+/**
+	Prepares the items of the crew class a few at a time,
+	so that the relaunch does not have to create all of them
+	in the same frame. Is called repeatedly during the
+	relaunch countdown, does nothing once the items are ready.
+ */
+public func PrepareCrewLoadout()
+{
+	var class = GetCrewClass();
+	if (!class) return;
 
-	// Weapons
-	if (class.Items)
+	// Start over if the class changed
+	if (cmc_crew_loadout && cmc_crew_loadout.Class != class)
 	{
-		var item_types = GetProperties(class.Items);
-		var item_count = GetLength(item_types);
-		var size = icon_size->Scale(item_count);
-		var item_info = new GUI_Element 
-		{
-			Priority = 4,
-
-			list = 
-			{
-				BackgroundColor = GUI_CMC_Background_Color_Default,
-				Bottom = size->ToString(),
-				Style = GUI_VerticalLayout,
-			}
-		};
-		var index = 0;
-		for (var item_type in item_types)
-		{
-			var item = class.Items[item_type].Type;
-			item_info.list[item_type] = AssembleClassTabInventoryIcon(index++, item, class.Items[item_type].Amount, icon_size);
-		}
-		item_info->SetHeight(size->Add(GuiDimensionCmc(nil, GUI_CMC_Margin_Element_V)))
-		         ->AddTo(menu->GetContentBox());
+		DiscardCrewLoadout();
+	}
+	if (!cmc_crew_loadout)
+	{
+		var stash = CreateObject(Dummy, 0, 0, NO_OWNER);
+		var pending = class->GetClassLoadout().Items[:]; // Copy, the template is shared
+		cmc_crew_loadout = {Class = class, Stash = stash, Pending = pending, Items = []};
+	}
+	for (var i = 0; i < CMC_CREW_LoadoutPerStep && GetLength(cmc_crew_loadout.Pending) > 0; ++i)
+	{
+		var item = cmc_crew_loadout.Stash->CreateContents(PopFront(cmc_crew_loadout.Pending));
+		PushBack(cmc_crew_loadout.Items, item);
 	}
+}
+
 
-	// Grenades
-	if (class.Grenades)
+// Moves the prepared items into the crew, returns false if they are not complete
+func TakeCrewLoadout()
+{
+	var loadout = cmc_crew_loadout;
+	var complete = loadout
+	            && loadout.Class == GetCrewClass()
+	            && GetLength(loadout.Pending) == 0
+	            && GetLength(loadout.Items) == loadout.Stash->ContentsCount();
+	if (complete)
 	{
-		var grenade_types = GetProperties(class.Grenades);
-		var grenade_count = GetLength(grenade_types);
-		var size = icon_size->Scale(grenade_count);
-		var grenade_info = new GUI_Element 
-		{
-			Priority = 5,
-
-			list = 
-			{
-				BackgroundColor = GUI_CMC_Background_Color_Default,
-				Bottom = size->ToString(),
-				Style = GUI_VerticalLayout,
-			}
-		};
-		var index = 0;
-		for (var grenade_type in grenade_types)
+		for (var item in loadout.Items)
 		{
-			var grenade = GetDefinition(grenade_type);
-			grenade_info.list[grenade_type] = AssembleClassTabInventoryIcon(index++, grenade, class.Grenades[grenade_type], icon_size);
+			item->SetOwner(GetOwner());
+			item->SetController(GetController());
+			item->Enter(this);
 		}
-		grenade_info->SetHeight(size->Add(GuiDimensionCmc(nil, GUI_CMC_Margin_Element_V)))
-		         ->AddTo(menu->GetContentBox());
 	}
+	DiscardCrewLoadout();
+	return complete;
 }
 
 
-// For respawn menu
-func AssembleClassTabAbilityIcon(int priority, id ability, proplist icon_size)
+func DiscardCrewLoadout()
 {
-	return
+	if (cmc_crew_loadout)
 	{
-		Priority = priority,
-		Tooltip = ability.Description,
-
-		icon = 
-		{
-			Right = icon_size->ToString(),
-			Bottom = icon_size->ToString(),
-			Symbol = ability,
-		},
-
-		label = 
+		if (cmc_crew_loadout.Stash)
 		{
-			Left = icon_size->Add(GuiDimensionCmc(nil, GUI_CMC_Margin_Element_Small_H))->ToString(),
-			Style = GUI_TextVCenter,
-			Text = ability->GetName(),
-		},
-	};
+			cmc_crew_loadout.Stash->RemoveObject(); // Removes the remaining items, too
+		}
+		cmc_crew_loadout = nil;
+	}
 }
 
-// For respawn menu
-func AssembleClassTabAmmoIcon(int priority, id ammo, int amount, proplist icon_size)
+/* --- Callbacks from respawn system --- */
+
+public func OnOpenRespawnMenu(proplist menu)
 {
-	return
+	_inherited(menu, ...);
+
+	// Add class selection tabs
+	for (var class in this->GetAvailableClasses())
 	{
-		Priority = priority,
-		Right = icon_size->ToString(),
-		Bottom = icon_size->ToString(),
-
-		Symbol = ammo,
-		Text = Format("%dx", amount),
-		Tooltip = ammo->GetName(),
-		Style = GUI_TextBottom | GUI_TextRight,
-	};
+		menu->GetTabs()->AddTab(class,                                               // identifier
+		                        class->~GetName(),                                   // label text
+		                        BindCallback(this.OnSelectClassTab, menu, class)); // called on button click
+	}
+	menu->GetTabs()->SelectTab();
 }
 
-// For respawn menu
-func AssembleClassTabInventoryIcon(int priority, id item, int amount, proplist icon_size)
+public func OnSelectClassTab(proplist menu, id class)
 {
-	return
-	{
-		Priority = priority,
-		Tooltip = item.Description,
+	ProfileBegin("ClassSystem::OnSelectClassTab");
 
-		Bottom = icon_size->ToString(),
+	// Update the class
+	SetCrewClass(class);
+
+	// Update the contents box
+	menu->ResetContentBox();
+
+	// --- Actual contents, from the layout of the class
 
-		icon = 
+	var layout = class->~CopyClassTabLayout();
+	if (layout)
+	{
+		var contents = new GUI_Element
 		{
-			Right = icon_size->ToString(),
-			Bottom = icon_size->ToString(),
-			Symbol = item,
-
-			count = 
-			{			
-				Text = Format("%dx", amount),
-				Style = GUI_TextBottom | GUI_TextRight,
-			},
-		},
-
-		label = 
+			Style = GUI_VerticalLayout,
+		};
+		for (var section in GetProperties(layout))
 		{
-			Left = icon_size->Add(GuiDimensionCmc(nil, GUI_CMC_Margin_Element_Small_H))->ToString(),
-			Style = GUI_TextVCenter,
-			Text = item->GetName(),
-		},
-	};
+			contents[section] = layout[section];
+		}
+		contents->AddTo(menu->GetContentBox());
+	}
+
+	ProfileEnd("ClassSystem::OnSelectClassTab");
 }
@@ -5,40 +5,107 @@
 	the structure is saved in an array, because if it were a proplist the GUI
 	system would try to render it as a subwindow.
 
+	The array is [target, command, parameters...] and contains only the
+	parameters that were actually defined.
+
 	@author Marky
 
 */
 
+static callbacks_interned; // Callbacks without parameters, by definition, see StaticCallback()
+
 
-// Defines a callback that can be used with DoCallback()
+// Defines a callback that can be used with InvokeCallback()
 // The callback target is the object that calls this function.
-global func DefineCallback(command, par0, par1, par2, par3, par4, par5, par6, par7, par8)
+global func BindCallback(command, par0, par1, par2, par3, par4, par5, par6, par7, par8)
 {
-	var callback = [];
-	callback[0] = this;
-	callback[1] = command;
-	callback[2] = [];
-
-	callback[2][0] = par0;
-	callback[2][1] = par1;
-	callback[2][2] = par2;
-	callback[2][3] = par3;
-	callback[2][4] = par4;
-	callback[2][5] = par5;
-	callback[2][6] = par6;
-	callback[2][7] = par7;
-	callback[2][8] = par8;
+	// Save only up to the last defined parameter
+	var count = 0;
+	for (var i = 1; i <= 9; ++i)
+	{
+		if (Par(i) != nil)
+		{
+			count = i;
+		}
+	}
+
+	var callback = [this, command];
+	for (var i = 1; i <= count; ++i)
+	{
+		callback[i + 1] = Par(i);
+	}
 	return callback;
 }
 
-// Executes a callback that was defined with DefineCallback()
+
+// Gets a callback without parameters for the calling definition.
+// The callback is created only once per definition and command,
+// so it must not be modified.
+global func StaticCallback(command)
+{
+	if (GetType(this) != C4V_Def)
+	{
+		return BindCallback(command);
+	}
+
+	callbacks_interned = callbacks_interned ?? {};
+	var key = Format("%i", this);
+	var interned = callbacks_interned[key] ?? [];
+	for (var callback in interned)
+	{
+		if (callback[1] == command)
+		{
+			return callback;
+		}
+	}
+	var callback = [this, command];
+	PushBack(interned, callback);
+	callbacks_interned[key] = interned;
+	return callback;
+}
+
+
+// Executes a callback that was defined with BindCallback()
 // Supports function parameters if the definition via
-// DefineCallback() does not provide them.
-global func DoCallback(array callback)
+// BindCallback() does not provide them.
+global func InvokeCallback(array callback, ...)
 {
-	var call_from = callback[0];
+	var target = callback[0];
 	var command = callback[1];
-	var par = callback[2];
-	
-	return call_from->Call(command, par[0] ?? Par(1), par[1] ?? Par(2), par[2] ?? Par(3), par[3] ?? Par(4), par[4] ?? Par(5), par[5] ?? Par(6), par[6] ?? Par(7), par[7] ?? Par(8), par[8] ?? Par(9));
+	var count = GetLength(callback) - 2;
+
+	// Most callbacks have few parameters; '...' would forward the parameters
+	// from Par(1) on, so the remaining parameters are passed explicitly, each in its own position
+	if (count == 0)
+	{
+		return target->Call(command, ...);
+	}
+	if (count == 1)
+	{
+		return target->Call(command, callback[2] ?? Par(1), Par(2), Par(3), Par(4), Par(5), Par(6), Par(7), Par(8), Par(9));
+	}
+	if (count == 2)
+	{
+		return target->Call(command, callback[2] ?? Par(1), callback[3] ?? Par(2), Par(3), Par(4), Par(5), Par(6), Par(7), Par(8), Par(9));
+	}
+	if (count == 3)
+	{
+		return target->Call(command, callback[2] ?? Par(1), callback[3] ?? Par(2), callback[4] ?? Par(3), Par(4), Par(5), Par(6), Par(7), Par(8), Par(9));
+	}
+	return target->Call(command, callback[2] ?? Par(1), callback[3] ?? Par(2), callback[4] ?? Par(3), callback[5] ?? Par(4), callback[6] ?? Par(5), callback[7] ?? Par(6), callback[8] ?? Par(7), callback[9] ?? Par(8), callback[10] ?? Par(9));
+}
+
+/* --- Old interface --- */
+
+// Same as BindCallback()
+global func DefineCallback(command, par0, par1, par2, par3, par4, par5, par6, par7, par8)
+{
+	return BindCallback(command, par0, par1, par2, par3, par4, par5, par6, par7, par8);
+}
+
+
+// Same as InvokeCallback()
+global func DoCallback(array callback, ...)
+{
+	return InvokeCallback(callback, ...);
 }
@@ -53,7 +53,9 @@ func OnPressUse(object clonk, int x, int y)
 	{
 		ContinueAiming(clonk, x, y, true);
 		// Call library default firing mechanic
+		ProfileBegin("Firearm::DoFireCycle");
 		DoFireCycle(clonk, x, y, false);
+		ProfileEnd("Firearm::DoFireCycle");
 	}
 	// Otherwise, start hip firing
 	else
@@ -69,7 +71,9 @@ func OnHoldingUse(object clonk, int x, int y)
 	if (IsAutoFiring())
 	{
 		// Call library default firing mechanic
+		ProfileBegin("Firearm::DoFireCycle");
 		DoFireCycle(clonk, x, y, false);
+		ProfileEnd("Firearm::DoFireCycle");
 		// Adjust cursor
 		clonk->~UpdateCmcVirtualCursor(this, x, y);
 	}
@@ -311,11 +315,13 @@ func FinishAiming(object clonk, string aim_type, int x, int y)
 // To be called every frame (preferably) during aiming
 func ContinueAiming(object clonk, int x, int y, bool button_pressed)
 {
+	ProfileBegin("Firearm::ContinueAiming");
 	var angle = GetAngle(x, y);
 	clonk->SetAimPosition(angle);
 	aim_target = [clonk->GetX() + x, clonk->GetY() + y];
 
 	Call(Format("~Continue%sAim", current_aim_type), clonk, button_pressed);
+	ProfileEnd("Firearm::ContinueAiming");
 }
 
 func FailedAiming(object clonk, string aim_type)
@@ -427,7 +433,9 @@ func SetHipFireAim(object clonk, int x, int y)
 	this->CreateEffect(HipFireEffect, 1, 1, clonk);
 	// Fire away!
 	// Call library default firing mechanic
+	ProfileBegin("Firearm::DoFireCycle");
 	DoFireCycle(clonk, x, y, false);
+	ProfileEnd("Firearm::DoFireCycle");
 }
 
 func ContinueHipFireAim(object clonk, bool button_pressed)
@@ -875,14 +883,17 @@ public func GetListSelectionMenuEntries(object user, string type, proplist main_
 				next_index = toggle_modes[next];
 			}
 
+			// Clicking any entry closes the menu, so the entries share one callback
+			var close_menu = BindCallback(this.CloseListSelectionMenu, true);
+
 			var default_entry = list->MakeEntryProplist();
 			var default_action = "$ChangeFireTechnique$";
 			if (next_index > -1)
 			{
 				default_action = Format("%s (<c %x>%s</c>)", default_action, GUI_CMC_Text_Color_Highlight, GetFiremode(next_index)->GetName());
-			    default_entry->SetCallbackOnMouseIn(list->DefineCallback(list.SelectEntry, default_action))             // Select the entry by hovering; the other possibilities are scrolling and hotkey
-			                 ->SetCallbackOnClick(this->DefineCallback(this.CloseListSelectionMenu, true))              // Clicking the entry closes the menu; It is automatically selected, because you hover the entry to click it; 'false' means that the selection is not cancelled
-			                 ->SetCallbackOnMenuClosed(this->DefineCallback(this.DoMenuFiremodeSelection, next_index)); // Closing the menu selects the entry
+			    default_entry->SetCallbackOnMouseIn(list->BindCallback(list.SelectEntry, default_action))             // Select the entry by hovering; the other possibilities are scrolling and hotkey
+			                 ->SetCallbackOnClick(close_menu)                                                            // Clicking the entry closes the menu; It is automatically selected, because you hover the entry to click it; 'false' means that the selection is not cancelled
+			                 ->SetCallbackOnMenuClosed(this->BindCallback(this.DoMenuFiremodeSelection, next_index)); // Closing the menu selects the entry
 			}
 			else
 			{
@@ -912,9 +923,9 @@ public func GetListSelectionMenuEntries(object user, string type, proplist main_
 				var entry = list->MakeEntryProplist();
 				entry->SetIcon(current_ammo_type)
 				     ->SetCaption(name)
-				     ->SetCallbackOnMouseIn(list->DefineCallback(list.SelectEntry, name))           // Select the entry by hovering; the other possibilities are scrolling and hotkey
-				     ->SetCallbackOnClick(DefineCallback(this.CloseListSelectionMenu, true))        // Clicking the entry closes the menu; It is automatically selected, because you hover the entry to click it; 'false' means that the selection is not cancelled
-				     ->SetCallbackOnMenuClosed(DefineCallback(this.DoMenuFiremodeSelection, index)) // Closing the menu selects the entry
+				     ->SetCallbackOnMouseIn(list->BindCallback(list.SelectEntry, name))           // Select the entry by hovering; the other possibilities are scrolling and hotkey
+				     ->SetCallbackOnClick(close_menu)                                             // Clicking the entry closes the menu; It is automatically selected, because you hover the entry to click it; 'false' means that the selection is not cancelled
+				     ->SetCallbackOnMenuClosed(BindCallback(this.DoMenuFiremodeSelection, index)) // Closing the menu selects the entry
 				     ->SetScrollHint(true);
 				list->AddEntry(name, entry);
 				SetListSelectionMenuHotkey(entry, index);
@@ -955,7 +966,7 @@ public func SetFiremode(int number, bool force)
 
 func FireSound(object user, proplist firemode)
 {
-	Sound(firemode->GetCurrentFireSound(), {multiple = true});
+	Sound(firemode->GetCurrentFireSound(), {multiple = true, priority = SOUND_Priority_Low});
 }
 
 func PlaySoundDeploy(object user)
@@ -27,6 +27,13 @@ public func CanConfigureTeams()
 }
 
 
+// Enables the script profiler, see System.ocg/Script_Profiler.c. Scenarios may overload this.
+public func UseScriptProfiler()
+{
+	return false;
+}
+
+
 // Crews are contained at this point by default. Scenarios may overload this.
 func ContainCrewAt()
 {
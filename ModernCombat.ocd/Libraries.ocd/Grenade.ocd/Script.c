@@ -64,7 +64,7 @@ func PlaySoundDetonation()
 
 func PlaySoundHit()
 {
-	Sound("Items::Grenades::FieldGrenade::Hit?", {multiple = true});
+	Sound("Items::Grenades::FieldGrenade::Hit?", {multiple = true, priority = SOUND_Priority_High});
 }
 
 
@@ -73,7 +73,7 @@ func PlaySoundHit()
 // What happens when the grenade explodes
 public func OnDetonation()
 {
-	Explode(30, true, 60);
+	Explosion([30], [60], true);
 }
 
 // If max damage is acquired
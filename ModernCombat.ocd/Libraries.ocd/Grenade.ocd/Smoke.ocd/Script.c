@@ -16,7 +16,7 @@ func IsAffectedBySmokeGrenade()
 func BlindedBySmokeGrenade(object grenade)
 {
 	var HUD = this->~GetHUDController();
-	if (HUD && GetType(HUD.GetColorLayer) == C4V_Function && !GetEffect("BlindedBySmoke", this))
+	if (HUD && GetType(HUD.SetColorLayer) == C4V_Function && !GetEffect("BlindedBySmoke", this))
 	{
 		CreateEffect(BlindedBySmoke, 1, 1, grenade->GetController());
 	}
@@ -36,8 +36,6 @@ local BlindedBySmoke = new Effect
 
 	Timer = func (int time)
 	{
-		var overlay = this.Target->GetHUDController()->GetColorLayer(this.Target, this.ColorLayer);
-
 		var change_alpha = -10;
 		var blinded = ObjectCount(Find_ID(CMC_Grenade_SmokeHelper), Find_Func("CanAffect", this.Target)) > 0;
 		if (blinded)
@@ -46,7 +44,7 @@ local BlindedBySmoke = new Effect
 		}
 		this.Alpha = BoundBy(this.Alpha + change_alpha, 0, this.AlphaMax);
 
-		overlay->Update({BackgroundColor = RGBa(150, 150, 150, this.Alpha)});
+		this.Target->GetHUDController()->SetColorLayer(this.Target, this.ColorLayer, RGBa(150, 150, 150, this.Alpha));
 
 		if (this.Alpha == 0)
 		{
@@ -58,7 +56,7 @@ local BlindedBySmoke = new Effect
 	{
 		if (!temp && this.Target)
 		{
-			this.Target->GetHUDController()->GetColorLayer(this.Target, this.ColorLayer)->Update({BackgroundColor = nil});
+			this.Target->GetHUDController()->SetColorLayer(this.Target, this.ColorLayer, nil);
 		}
 	},
 };
@@ -7,13 +7,25 @@
 	@author Marky
  */
 
-func IsAffectedByStunGrenade(object grenade, int full_range, int short_range)
+func IsAffectedByStunGrenade(object grenade, int full_range, int short_range, proplist profile)
 {
 	return !Contained()
 	    && GetAlive()
 	    // In short range, or has a clear view on the grenade / flash
 	    && (ObjectDistance(grenade) <= short_range
-	    || !PathFree(GetX(), GetY() - 4, grenade->GetX(), grenade->GetY() - 4));
+	    || !HasPathToStunGrenade(grenade, profile));
+}
+
+
+// Same as PathFree() from the object to the grenade, 4 pixels higher;
+// Uses the visibility profile of the detonation if there is one
+func HasPathToStunGrenade(object grenade, proplist profile)
+{
+	if (profile)
+	{
+		return IsVisibleInProfile(profile, GetX(), GetY() - 4);
+	}
+	return PathFree(GetX(), GetY() - 4, grenade->GetX(), grenade->GetY() - 4);
 }
 
 
@@ -83,7 +95,7 @@ local BlindedByFlash = new Effect
 	{
 		if (!temp && this.Target && HasColorOverlay())
 		{
-			this.Target->GetHUDController()->GetColorLayer(this.Target, this.ColorLayer)->Update({BackgroundColor = nil});
+			this.Target->GetHUDController()->SetColorLayer(this.Target, this.ColorLayer, nil);
 		}
 	},
 
@@ -105,8 +117,7 @@ local BlindedByFlash = new Effect
 	{
 		if (HasColorOverlay())
 		{
-			var overlay = this.Target->GetHUDController()->GetColorLayer(this.Target, this.ColorLayer);
-			overlay->Update({BackgroundColor = RGBa(255, 255, 255, BoundBy(this.Intensity, 0, 255)), });
+			this.Target->GetHUDController()->SetColorLayer(this.Target, this.ColorLayer, RGBa(255, 255, 255, BoundBy(this.Intensity, 0, 255)));
 		}
 	},
 
@@ -127,7 +138,7 @@ local BlindedByFlash = new Effect
 
 	HasColorOverlay = func ()
 	{
-		return this.Target->GetHUDController() && this.Target->GetHUDController().GetColorLayer;
+		return this.Target->GetHUDController() && this.Target->GetHUDController().SetColorLayer;
 	}
 };
 
@@ -1,6 +1,10 @@
 /**
 	Library for grenade belt.
 
+	Grenades are counted, and a grenade object is created only if it is drawn.
+	Stashed grenades are kept in a reserve, one per type, so that switching
+	between grenade types does not create and remove objects all the time.
+
 	@author Marky
 */
 
@@ -19,9 +23,20 @@ func Initialize()
 		max_count = 4,
 		active_type_index = nil,
 		grenades = {},
+		reserve = nil, // Container for stashed grenade objects, see GetGrenadeReserve()
 	};
 }
 
+
+func Destruction()
+{
+	if (cmc_grenade_belt.reserve)
+	{
+		cmc_grenade_belt.reserve->RemoveObject();
+	}
+	_inherited(...);
+}
+
 /* --- Interface --- */
 
 /**
@@ -41,7 +56,7 @@ public func TakeGrenade(id type)
 	var count = GetGrenadeCount(type);
 	if (count > 0)
 	{
-		var grenade = CreateObject(type, 0, 0, NO_OWNER);
+		var grenade = TakeReserveGrenade(type) ?? CreateObject(type, 0, 0, NO_OWNER);
 		Collect(grenade);
 
 		if (grenade)
@@ -61,7 +76,7 @@ public func TakeGrenade(id type)
 			}
 			else
 			{
-				grenade->RemoveObject();
+				StoreReserveGrenade(grenade);
 			}
 		}
 	}
@@ -83,7 +98,7 @@ public func StashGrenade(object grenade)
 		}
 		else if (DoGrenadeCount(grenade->GetID(), 1) == 1)
 		{
-			grenade->RemoveObject();
+			StoreReserveGrenade(grenade);
 			return true;
 		}
 		return false;
@@ -196,6 +211,48 @@ func SetCurrentGrenadeType(id type)
 }
 
 
+// Container for the stashed grenades, out of the inventory
+func GetGrenadeReserve()
+{
+	if (!cmc_grenade_belt.reserve)
+	{
+		cmc_grenade_belt.reserve = CreateObject(Dummy, 0, 0, NO_OWNER);
+		cmc_grenade_belt.reserve.IsGrenadeReserve = true;
+	}
+	return cmc_grenade_belt.reserve;
+}
+
+
+// Gets a stashed grenade of that type, if there is one
+func TakeReserveGrenade(id type)
+{
+	if (cmc_grenade_belt.reserve)
+	{
+		return cmc_grenade_belt.reserve->FindContents(type);
+	}
+	return nil;
+}
+
+
+// Keeps one grenade of each type, so that it can be drawn again
+func StoreReserveGrenade(object grenade)
+{
+	var reserve = GetGrenadeReserve();
+	if (grenade->IsActive() || reserve->FindContents(grenade->GetID()))
+	{
+		grenade->RemoveObject();
+	}
+	else
+	{
+		grenade->Enter(reserve);
+		if (grenade->Contained() != reserve)
+		{
+			grenade->RemoveObject();
+		}
+	}
+}
+
+
 /* --- Controls --- */
 
 func ObjectControl(int player, int control, int x, int y, int strength, bool repeat, int status)
@@ -248,6 +305,7 @@ public func GetListSelectionMenuEntries(object user, string type, proplist main_
 			var list = main_menu->GetList();
 			var hotkey = 0;
 			var current_type = GetCurrentGrenadeType();
+			var close_menu = this->BindCallback(Library_ListSelectionMenu.CloseListSelectionMenu, true); // Shared by all entries
 
 			// Add entry for drawing the current grenade type
 			var default_entry = list->MakeEntryProplist();
@@ -257,9 +315,9 @@ public func GetListSelectionMenuEntries(object user, string type, proplist main_
 				default_action = Format("%s (<c %x>%s</c>)", default_action, GUI_CMC_Text_Color_Highlight, current_type->GetName());
 			}
 			default_entry->SetCaption(default_action)
-			             ->SetCallbackOnMouseIn(list->DefineCallback(list.SelectEntry, default_action))           // Select the entry by hovering; the other possibilities are scrolling and hotkey
-			             ->SetCallbackOnClick(this->DefineCallback(Library_ListSelectionMenu.CloseListSelectionMenu, true))       // Clicking the entry closes the menu; It is automatically selected, because you hover the entry to click it; 'false' means that the selection is not cancelled
-			             ->SetCallbackOnMenuClosed(this->DefineCallback(this.TakeGrenade, current_type)) // Closing the menu selects the entry
+			             ->SetCallbackOnMouseIn(list->BindCallback(list.SelectEntry, default_action))           // Select the entry by hovering; the other possibilities are scrolling and hotkey
+			             ->SetCallbackOnClick(close_menu)       // Clicking the entry closes the menu; It is automatically selected, because you hover the entry to click it; 'false' means that the selection is not cancelled
+			             ->SetCallbackOnMenuClosed(this->BindCallback(this.TakeGrenade, current_type)) // Closing the menu selects the entry
 			             ->SetScrollHint(true);
 			list->AddEntry(default_action, default_entry);
 			this->~SetListSelectionMenuHotkey(default_entry, 9);
@@ -300,9 +358,9 @@ public func GetListSelectionMenuEntries(object user, string type, proplist main_
 				}
 				else
 				{
-				     entry->SetCallbackOnMouseIn(list->DefineCallback(list.SelectEntry, name))           // Select the entry by hovering; the other possibilities are scrolling and hotkey
-				          ->SetCallbackOnClick(this->DefineCallback(Library_ListSelectionMenu.CloseListSelectionMenu, true))       // Clicking the entry closes the menu; It is automatically selected, because you hover the entry to click it; 'false' means that the selection is not cancelled
-				          ->SetCallbackOnMenuClosed(this->DefineCallback(this.SetCurrentGrenadeType, grenade_type)); // Closing the menu selects the entry
+				     entry->SetCallbackOnMouseIn(list->BindCallback(list.SelectEntry, name))           // Select the entry by hovering; the other possibilities are scrolling and hotkey
+				          ->SetCallbackOnClick(close_menu)       // Clicking the entry closes the menu; It is automatically selected, because you hover the entry to click it; 'false' means that the selection is not cancelled
+				          ->SetCallbackOnMenuClosed(this->BindCallback(this.SetCurrentGrenadeType, grenade_type)); // Closing the menu selects the entry
 				}
 				list->AddEntry(name, entry);
 				this->~SetListSelectionMenuHotkey(entry, hotkey++);
@@ -319,6 +319,11 @@ func Departure(object from)
 
 func RejectEntrance(object into)
 {
+	// The grenade belt keeps one grenade of each type
+	if (into.IsGrenadeReserve)
+	{
+		return false;
+	}
 	var other_grenade = FindObject(Find_Func("IsGrenade"), Find_Container(into));
 	if (other_grenade)
 	{
@@ -26,33 +26,79 @@ public func SetAmmoRefillInterval(int interval)
 	var refill = GetEffect("RefillAmmoEffect", this) ?? CreateEffect(RefillAmmoEffect, 1, interval);
 	if (refill)
 	{
-		refill.Interval = interval;
+		refill.RefillInterval = interval;
+		if (!refill.dormant)
+		{
+			refill.Interval = interval;
+		}
 		return true;
 	}
 	return false;
 }
 
 
+func Entrance(object into)
+{
+	WakeAmmoRefill();
+	return _inherited(into, ...);
+}
+
+
+// Resumes the refill effect if the pack can be refilled
+func WakeAmmoRefill()
+{
+	var refill = GetEffect("RefillAmmoEffect", this);
+	if (refill && refill.dormant && Contained() && GetAmmoCount() < this->MaxAmmo())
+	{
+		refill->Wake();
+	}
+}
+
+
 // Refill!
 local RefillAmmoEffect = new Effect
 {
+	Name = "RefillAmmoEffect",
+
+	Start = func (int temporary)
+	{
+		if (!temporary)
+		{
+			this.start_frame = FrameCounter();
+			this.RefillInterval = this.Interval;
+		}
+		return FX_OK;
+	},
+
 	Timer = func ()
 	{
-		// Already filled?
-		if (Target->GetAmmoCount() >= Target->MaxAmmo())
+		// Already filled? Nothing to do until ammo is used up, see WakeAmmoRefill()
+		var user = Target->Contained();
+		if (!user || Target->GetAmmoCount() >= Target->MaxAmmo())
 		{
+			this.dormant = true;
+			this.Interval = 0;
 			return FX_OK;
 		}
 
 		// Do it!
-		var user = Target->Contained();
 		var can_refill = Target->~AllowAmmoRefill(user);
-		if (user && can_refill)
+		if (can_refill)
 		{
 			Target->DoAmmoCount(1);
 		}
 		return FX_OK;
 	},
+
+	Wake = func ()
+	{
+		// The effect time does not advance while the effect is dormant.
+		// Set it as if the timer had been running all the time, so that
+		// the refill happens in the same frames as without suspension.
+		this.dormant = false;
+		this.Time = FrameCounter() - this.start_frame;
+		this.Interval = this.RefillInterval;
+	},
 };
 
 
@@ -66,6 +112,10 @@ func GetAmmoCount()
 func DoAmmoCount(int change)
 {
 	var difference = this->DoAmmo(GetID(), change);
+	if (difference < 0)
+	{
+		WakeAmmoRefill();
+	}
 	if (difference && Contained())
 	{
 		Contained()->~OnInventoryChange(); // Notify HUD
@@ -147,7 +147,8 @@ public func ShowListSelectionMenu()
 {
 	if (cmc_list_selection_menu)
 	{
-		cmc_list_selection_menu.menu->Show()->Update();
+		var menu = cmc_list_selection_menu.menu;
+		menu->Show()->Update({Player = menu.Player});
 	}
 }
 
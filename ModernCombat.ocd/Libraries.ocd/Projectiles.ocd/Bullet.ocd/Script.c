@@ -44,6 +44,8 @@ public func OnHitObject(object target, proplist hitcheck_effect)
  */
 public func OnHitLandscape()
 {
+	ProfileBegin("Bullet::OnHitLandscape");
+
 	// Sound
 	if (!MaterialProperties.hit_water)
 	{
@@ -64,37 +66,16 @@ public func OnHitLandscape()
 		var dust_size = 3 * MaterialProperties.dust_factor;
 		var dust_xdir = +Sin(hit_angle, -1, precision);
 		var dust_ydir = -Cos(hit_angle, -1, precision);
-		CreateParticle("Dust", PV_Random(-1, 1), PV_Random(-1, 1), PV_Random(dust_xdir - 1, dust_xdir + 1), PV_Random(dust_ydir - 1, dust_ydir + 1), PV_Random(20, 40),
+		var dust_amount = RequestParticles("BulletDust", 3);
+		if (dust_amount > 0)
 		{
-			Prototype = Particles_Dust(),
-			Alpha = PV_KeyFrames(0, 0, 0, 250, 50, 1000, 0),
-			R = MaterialProperties.color.R, B = MaterialProperties.color.B, G = MaterialProperties.color.G,
-			Size = PV_KeyFrames(0, 0, 5 * dust_size / 12, 100, dust_size, 1000, 7 * dust_size / 12),
-		}, 3);
+			CreateParticle("Dust", PV_Random(-1, 1), PV_Random(-1, 1), PV_Random(dust_xdir - 1, dust_xdir + 1), PV_Random(dust_ydir - 1, dust_ydir + 1), PV_Random(20, 40), GetDustParticles(dust_size), dust_amount);
+		}
 
 		// Debris
 		var particle_name = MaterialProperties.particle_type ?? "Air";
-		var particles =
-		{
-			CollisionVertex = 500,
-			OnCollision = PC_Bounce(100),
-			ForceY = PV_Gravity(900),
-			Rotation = PV_Direction(),
-			Size = PV_Random(1, Max(1, MaterialProperties.shape)),
-		    R = MaterialProperties.color.R,
-		    G = MaterialProperties.color.G,
-			B = MaterialProperties.color.B,
-		};
-		if (MaterialProperties.in_liquid)
-		{
-			particles.DampingX = 650;
-			particles.DampingY = 650;
-		}
-		if (MaterialProperties.particle_phase)
-		{
-			particles.Phase = MaterialProperties.particle_phase;
-		}
-		var amount = RandomX(1, 2 + MaterialProperties.dust_factor);
+		var particles = GetDebrisParticles(particle_name);
+		var amount = RequestParticles("BulletDebris", RandomX(1, 2 + MaterialProperties.dust_factor));
 		for (var i = 0; i < amount; ++i)
 		{
 			var angle = RandomX(hit_angle - 20, hit_angle + 20);
@@ -103,7 +84,11 @@ public func OnHitLandscape()
 			var ydir = -Cos(angle, speed, precision) + Cos(hit_angle, 5, precision);
 			CreateParticle(particle_name, -Sign(GetXDir()), -Sign(GetYDir()), xdir, ydir, PV_Random(20, 60), particles, 1);
 		}
-		CreateParticle(particle_name, PV_Random(-1, 1), PV_Random(-1, 1), PV_Random(-3, 3), PV_Random(-3, 3), PV_Random(20, 40), particles, 2);
+		var debris_amount = RequestParticles("BulletDebris", 2);
+		if (debris_amount > 0)
+		{
+			CreateParticle(particle_name, PV_Random(-1, 1), PV_Random(-1, 1), PV_Random(-3, 3), PV_Random(-3, 3), PV_Random(20, 40), particles, debris_amount);
+		}
 	}
 
 	// Sparks
@@ -111,10 +96,20 @@ public func OnHitLandscape()
 	{
 		var xdir = +Sin(hit_angle, -6, precision);
 		var ydir = -Cos(hit_angle, -6, precision);
-		CreateParticle("Frazzle", 0, 0, PV_Random(xdir - 1, xdir + 1), PV_Random(ydir - 1, ydir + 1), PV_Random(20, 40), { Prototype = Particles_Glimmer(), Phase = PV_Random(0, 4)}, 2 * MaterialProperties.spark_factor);
-		CreateParticle("Frazzle", PV_Random(-2, 2), PV_Random(-2, 2), PV_Random(-3, +3), PV_Random(-3, +3), PV_Random(20, 40), { Prototype = Particles_Glimmer(), Phase = PV_Random(0, 4)}, 3);
+		var spark_amount = RequestParticles("BulletSparks", 2 * MaterialProperties.spark_factor);
+		if (spark_amount > 0)
+		{
+			CreateParticle("Frazzle", 0, 0, PV_Random(xdir - 1, xdir + 1), PV_Random(ydir - 1, ydir + 1), PV_Random(20, 40), GetGlimmerParticles(), spark_amount);
+		}
+		spark_amount = RequestParticles("BulletSparks", 3);
+		if (spark_amount > 0)
+		{
+			CreateParticle("Frazzle", PV_Random(-2, 2), PV_Random(-2, 2), PV_Random(-3, +3), PV_Random(-3, +3), PV_Random(20, 40), GetGlimmerParticles(), spark_amount);
+		}
 	}
 	DrawSpark();
+
+	ProfileEnd("Bullet::OnHitLandscape");
 }
 
 /**
@@ -136,11 +131,15 @@ public func OnHitLandscape()
  */
 public func OnHitScan(int x_start, int y_start, int x_end, int y_end)
 {
+	ProfileBegin("Bullet::OnHitScan");
+
 	var x = Sign(GetXDir());
 	var y = Sign(GetYDir());
 	MaterialProperties = GetMaterialProperties(x + x_end - GetX(), y + y_end - GetY());
 	DrawBubbles(x_start, y_start, x_end, y_end);
 	DrawTrace(x_start, y_start, x_end, y_end);
+
+	ProfileEnd("Bullet::OnHitScan");
 }
 
 /* --- Display --- */
@@ -177,6 +176,7 @@ func DrawBubbles(int x_start, int y_start, int x_end, int y_end)
 				SoundAt("Projectiles::Shared::HitWater?", x, y);
 			}
 			if (Random(3)) continue;
+			if (!RequestParticles("BulletBubbles", 1, PARTICLE_Priority_Low, x, y)) continue;
 			CreateObject(Fx_Bubble, x, y, NO_OWNER)->SetSpeed(GetXDir() / 30 + RandomX(-5, 5), GetYDir() / 30 + RandomX(-5, 5));
 		}
 	}
@@ -193,13 +193,16 @@ func DrawBubbles(int x_start, int y_start, int x_end, int y_end)
 		impact_y += 1;
 
 		// The splash
-		CreateParticle("RaindropSplash", impact_x, impact_y, 0, 0, PV_Random(7, 12), Particles_Splash(MaterialProperties.hit_water.Color), 0);
+		if (RequestParticles("BulletSplash", 1, nil, impact_x, impact_y))
+		{
+			CreateParticle("RaindropSplash", impact_x, impact_y, 0, 0, PV_Random(7, 12), GetSplashParticles(MaterialProperties.hit_water.Color), 0);
+		}
 
-		var particles = {Prototype = Particles_RainSmall(MaterialProperties.hit_water.Color), OnCollision = PC_Stop(), Stretch = PV_Speed(1500), Alpha = PV_Linear(150, 0)};
+		var particles = GetDropParticles(MaterialProperties.hit_water.Color);
 		// Some drops
 		var precision = 10;
 		var hit_angle = Angle(0, 0, GetXDir(), GetYDir(), precision);
-		var amount = RandomX(3, 5);
+		var amount = RequestParticles("BulletSplash", RandomX(3, 5), nil, impact_x, impact_y);
 		for (var i = 0; i < amount; ++i)
 		{
 			var angle = RandomX(hit_angle - 10, hit_angle + 10);
@@ -208,7 +211,11 @@ func DrawBubbles(int x_start, int y_start, int x_end, int y_end)
 			var ydir = -Cos(angle, speed, precision);
 			CreateParticle("Air", impact_x, impact_y - 2, xdir, ydir, PV_Random(20, 60), particles, 1);
 		}
-		CreateParticle("Air", impact_x, impact_y - 2, PV_Random(-5, 5), PV_Random(-10, -20), PV_Random(20, 60), particles, RandomX(3, 7));
+		var drop_amount = RequestParticles("BulletSplash", RandomX(3, 7), nil, impact_x, impact_y);
+		if (drop_amount > 0)
+		{
+			CreateParticle("Air", impact_x, impact_y - 2, PV_Random(-5, 5), PV_Random(-10, -20), PV_Random(20, 60), particles, drop_amount);
+		}
 	}
 }
 
@@ -237,36 +244,121 @@ func DrawTrace(int x_start, int y_start, int x_end, int y_end)
 	// Determine creation offset
 	var x = (distance - position_start) * (x_start - x_end) / distance;
 	var y = (distance - position_start) * (y_start - y_end) / distance;
-	var angle = Angle(x_start, y_start, x_end, y_end);
-	var color_start = SplitRGBaValue(this->TrailColor(time_start));
-	var color_end = SplitRGBaValue(this->TrailColor(time_end));
+	if (!RequestParticles("BulletTrace", 1, PARTICLE_Priority_Low, x, y)) return;
 
-	CreateParticle("BulletTrace", x, y, +Sin(angle, particle_velocity), -Cos(angle, particle_velocity), time_interval,
+	var angle = Angle(x_start, y_start, x_end, y_end);
+	var color_start = this->TrailColor(time_start);
+	var color_end = this->TrailColor(time_end);
+	var key = Format("BulletTrace:%d:%d:%d", color_start, color_end, particle_size);
+	var trace = GetParticleDefinition(key);
+	if (!trace)
 	{
-		R = PV_Linear(color_start.R, color_end.R), G = PV_Linear(color_start.G, color_end.G), B = PV_Linear(color_start.B, color_end.B),
-		Size = particle_size,
-		Alpha = PV_Linear(80, 0),
-		Rotation = angle,
-		BlitMode = GFX_BLIT_Additive,
-		CollisionDensity = 25, // Collide with liquids
-		OnCollision = PC_Die(),
-	},
-	1);
+		var rgb_start = SplitRGBaValue(color_start);
+		var rgb_end = SplitRGBaValue(color_end);
+		trace = StoreParticleDefinition(key,
+		{
+			R = PV_Linear(rgb_start.R, rgb_end.R), G = PV_Linear(rgb_start.G, rgb_end.G), B = PV_Linear(rgb_start.B, rgb_end.B),
+			Size = particle_size,
+			Alpha = PV_Linear(80, 0),
+			BlitMode = GFX_BLIT_Additive,
+			CollisionDensity = 25, // Collide with liquids
+			OnCollision = PC_Die(),
+		});
+	}
+
+	// The rotation is the only property that differs with every shot
+	CreateParticle("BulletTrace", x, y, +Sin(angle, particle_velocity), -Cos(angle, particle_velocity), time_interval, {Prototype = trace, Rotation = angle}, 1);
 }
 
 func DrawSpark()
 {
-	CreateParticle("StarFlash", 0, 0, 0, 0, PV_Random(7, 11), {
+	if (!RequestParticles("BulletSparks", 1)) return;
+
+	var size = BoundBy(GetDamageAmount() / 2, 2, 5);
+	var key = Format("BulletSpark:%d", size);
+	var spark = GetParticleDefinition(key) ?? StoreParticleDefinition(key,
+	{
 	    R = 255,
 	    G = PV_Linear(196, 64),
 	    B = PV_Random(0, 128, 2),
 		Alpha = PV_Linear(160, 0),
 		Rotation = PV_Random(0, 360),
 		BlitMode = GFX_BLIT_Additive,
-		Size = PV_Linear(BoundBy(GetDamageAmount() / 2, 2, 5), 1),
+		Size = PV_Linear(size, 1),
+	});
+	CreateParticle("StarFlash", 0, 0, 0, 0, PV_Random(7, 11), spark);
+}
+
+/* --- Particle definitions --- */
+
+// Definitions are cached per material color and size, see GetParticleDefinition()
+
+func GetDustParticles(int size)
+{
+	var color = MaterialProperties.color;
+	var key = Format("BulletDust:%d:%d", RGB(color.R, color.G, color.B), size);
+	return GetParticleDefinition(key) ?? StoreParticleDefinition(key,
+	{
+		Prototype = Particles_Dust(),
+		Alpha = PV_KeyFrames(0, 0, 0, 250, 50, 1000, 0),
+		R = color.R, B = color.B, G = color.G,
+		Size = PV_KeyFrames(0, 0, 5 * size / 12, 100, size, 1000, 7 * size / 12),
 	});
 }
 
+
+func GetDebrisParticles(string particle_name)
+{
+	var color = MaterialProperties.color;
+	var key = Format("BulletDebris:%s:%d:%d:%v", particle_name, RGB(color.R, color.G, color.B), MaterialProperties.shape, !!MaterialProperties.in_liquid);
+	var particles = GetParticleDefinition(key);
+	if (!particles)
+	{
+		particles =
+		{
+			CollisionVertex = 500,
+			OnCollision = PC_Bounce(100),
+			ForceY = PV_Gravity(900),
+			Rotation = PV_Direction(),
+			Size = PV_Random(1, Max(1, MaterialProperties.shape)),
+		    R = color.R,
+		    G = color.G,
+			B = color.B,
+		};
+		if (MaterialProperties.in_liquid)
+		{
+			particles.DampingX = 650;
+			particles.DampingY = 650;
+		}
+		if (MaterialProperties.particle_phase)
+		{
+			particles.Phase = MaterialProperties.particle_phase;
+		}
+		StoreParticleDefinition(key, particles);
+	}
+	return particles;
+}
+
+
+func GetGlimmerParticles()
+{
+	return GetParticleDefinition("BulletGlimmer") ?? StoreParticleDefinition("BulletGlimmer", { Prototype = Particles_Glimmer(), Phase = PV_Random(0, 4)});
+}
+
+
+func GetSplashParticles(int color)
+{
+	var key = Format("BulletSplash:%d", color);
+	return GetParticleDefinition(key) ?? StoreParticleDefinition(key, Particles_Splash(color));
+}
+
+
+func GetDropParticles(int color)
+{
+	var key = Format("BulletDrops:%d", color);
+	return GetParticleDefinition(key) ?? StoreParticleDefinition(key, {Prototype = Particles_RainSmall(color), OnCollision = PC_Stop(), Stretch = PV_Speed(1500), Alpha = PV_Linear(150, 0)});
+}
+
 /* --- Properties --- */
 
 local Name = "$Name$";
@@ -22,6 +22,9 @@ local Missile_TracerControl = nil;  // The last detected tracer effect
 local Missile_TracerLinked = false; // Are we linked to that tracer?
 local Missile_TracerLaser = nil;    // Visualization which target is being approaced
 
+local Missile_SightInterval = 5;    // Line of sight to a target is checked again after this many frames
+local Missile_SightCache = nil;     // Last line of sight checks, by target
+
 /* --- Engine callbacks --- */
 
 func Destruction()
@@ -241,9 +244,11 @@ func HandleSmokeTrail()
 	var off_x = -max_x;
 	var off_y = -max_y;
 	var particle_distance = 25;
+	var steps = RequestParticles("MissileTrail", (distance + particle_distance - 1) / particle_distance, PARTICLE_Priority_Low);
 
-	for(var i = 0; i < distance; i += particle_distance)
+	for (var step = 0; step < steps; ++step)
 	{
+		var i = step * distance / steps;
 		var x = -max_x * i / distance;
 		var y = -max_y * i / distance;
 
@@ -380,13 +385,23 @@ func LoseTarget()
 
 func FindTracer()
 {
-	var targets = FindObjects(Find_Distance(this.Missile_TracerRadius), Sort_Distance());
-	for (var target in targets)
+	// Only tagged objects are candidates, closest first
+	var candidates = [];
+	for (var tracer in CMC_Projectile_TracerDart->GetTracers(GetController()))
+	{
+		var distance = ObjectDistance(tracer.Target);
+		if (distance <= this.Missile_TracerRadius)
+		{
+			PushBack(candidates, {Tracer = tracer, Distance = distance});
+		}
+	}
+	SortArrayByProperty(candidates, "Distance");
+
+	for (var candidate in candidates)
 	{
-		var tracer = CMC_Projectile_TracerDart->HasTracer(target, GetController());
-		if (tracer && HasLineOfSight(target))
+		if (HasLineOfSight(candidate.Tracer.Target))
 		{
-			return tracer;
+			return candidate.Tracer;
 		}
 	}
 	return nil;
@@ -396,7 +411,41 @@ func HasLineOfSight(object target)
 {
 	return target
        && (Distance(GetX(), GetY(), target->GetX(), target->GetY()) <= this.Missile_TracerRadius)
-	   &&  PathFree(GetX(), GetY(), target->GetX(), target->GetY());
+	   &&  HasFreePath(target);
+}
+
+// The line of sight is cached for Missile_SightInterval frames per target;
+// It is checked on the visibility grid, because homing does not need pixel accuracy
+func HasFreePath(object target)
+{
+	this.Missile_SightCache = this.Missile_SightCache ?? [];
+
+	var sight;
+	for (var i = 0; i < GetLength(this.Missile_SightCache); ++i)
+	{
+		var cached = this.Missile_SightCache[i];
+		if (cached.Target == target)
+		{
+			sight = cached;
+		}
+		else if (!cached.Target) // Target was removed
+		{
+			this.Missile_SightCache[i] = nil;
+		}
+	}
+	RemoveHoles(this.Missile_SightCache);
+	if (!sight)
+	{
+		sight = {Target = target, Frame = nil, Free = false};
+		PushBack(this.Missile_SightCache, sight);
+	}
+
+	if (sight.Frame == nil || FrameCounter() - sight.Frame >= this.Missile_SightInterval)
+	{
+		sight.Frame = FrameCounter();
+		sight.Free = CoarsePathFree(GetX(), GetY(), target->GetX(), target->GetY(), true);
+	}
+	return sight.Free;
 }
 
 func LaserUpdate(object target)
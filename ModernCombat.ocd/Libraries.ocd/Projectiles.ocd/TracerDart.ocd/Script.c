@@ -9,6 +9,8 @@ local Tracer_StartX = 0;
 local Tracer_StartY = 0;
 local Tracer_Color = 0;
 
+static tracer_registry; // Active tracer effects by player, see GetTracers()
+
 func IsTracer() { return true; } // For identification
 
 /* --- Launching --- */
@@ -183,6 +185,7 @@ local TracerDartTimer = new Effect
 			this.Team = GetPlayerTeam(player);
 			color = SplitRGBaValue(GetPlayerColor(player));
 			this.Color = RGBa(color.R, color.G, color.B, 250); //color;
+			CMC_Projectile_TracerDart->RegisterTracer(this);
 
 			// Tag the target
 			var tag = CMC_Icon_SensorBall_Tag->Get(this.Target, player, CMC_Projectile_TracerDart);
@@ -202,9 +205,15 @@ local TracerDartTimer = new Effect
 		return FX_OK;
 	},
 
-	Stop = func (int temp)
+	Stop = func (int reason)
 	{
-		if (!temp)
+		// Unregister on every actual removal, including death and clearing of the target
+		if (reason != FX_Call_Temp && reason != FX_Call_TempAddForRemoval)
+		{
+			CMC_Projectile_TracerDart->UnregisterTracer(this);
+		}
+
+		if (FX_Call_Normal == reason)
 		{
 			// Remove tag, if it did not happen already
 			var tag = CMC_Icon_SensorBall_Tag->Get(this.Target, player, CMC_Projectile_TracerDart);
@@ -290,3 +299,67 @@ func RemoveTracers(object target)
 	}
 }
 
+/**
+	Gets all tracer effects that a player can use.
+
+	@par player The tracers of this player and its allies are returned;
+	            {@code nil} returns the tracers of all players.
+	@return array The tracer effects, their targets are tagged.
+ */
+func GetTracers(int player)
+{
+	var tracers = [];
+	for (var entry in tracer_registry ?? [])
+	{
+		// Only for allies
+		if (player != nil && Hostile(player, entry.Player))
+		{
+			continue;
+		}
+		// Drop tracers whose target is gone
+		var active = [];
+		for (var tracer in entry.Tracers)
+		{
+			if (tracer && tracer.Target)
+			{
+				PushBack(active, tracer);
+				PushBack(tracers, tracer);
+			}
+		}
+		entry.Tracers = active;
+	}
+	return tracers;
+}
+
+func RegisterTracer(proplist tracer)
+{
+	tracer_registry = tracer_registry ?? [];
+	var entry = GetTracerRegistryEntry(tracer.By_Player);
+	if (!entry)
+	{
+		entry = {Player = tracer.By_Player, Tracers = []};
+		PushBack(tracer_registry, entry);
+	}
+	PushBack(entry.Tracers, tracer);
+}
+
+func UnregisterTracer(proplist tracer)
+{
+	var entry = GetTracerRegistryEntry(tracer.By_Player);
+	if (entry)
+	{
+		RemoveArrayValue(entry.Tracers, tracer, true);
+	}
+}
+
+func GetTracerRegistryEntry(int player)
+{
+	for (var entry in tracer_registry ?? [])
+	{
+		if (entry.Player == player)
+		{
+			return entry;
+		}
+	}
+	return nil;
+}
@@ -20,7 +20,17 @@ public func Initialize()
 
 	// Create the configuration - TODO: this has old style menus at the moment, will be changed
 	// to proper GUI menus soon
-	CreateObject(CMC_Game_Session_Configurator);
+	var configurator = CreateObject(CMC_Game_Session_Configurator);
+
+	// Script profiler, the host can log the values with /profile
+	if (configurator->UseScriptProfiler())
+	{
+		EnableProfiler(true);
+		AddMsgBoardCmd("profile", "ProfileDump()");
+	}
+
+	// The host can compare CoarsePathFree() to PathFree() with /coarsepath [samples]
+	AddMsgBoardCmd("coarsepath", "LogCoarsePathFreeReport(%s)", C4MSGCMDR_Identifier);
 
 	// A nice log message
 	Log("$InitializeScenario$");
@@ -120,6 +130,16 @@ private func CleanUpEquipment(int round_number)
 }
 
 
+// Override this function to return true if
+// the interior is the same in every round.
+// The first round records it, later rounds
+// restore only what changed.
+public func UseRoundSnapshot()
+{
+	return false;
+}
+
+
 /*--- Callbacks from Environment_RoundManager ---*/
 
 // These callbacks happen in order:
@@ -130,8 +150,29 @@ private func OnRoundReset(int round_number)
 	Log("$ResetScenario$");
 
 	// Interior objects and equipment should be reset at the start of the round
-	CreateInterior();
+	if (HasRoundSnapshot())
+	{
+		RestoreRoundSnapshot();
+	}
+	else if (UseRoundSnapshot())
+	{
+		BeginRoundSnapshot();
+		CreateInterior();
+		FinishRoundSnapshot();
+	}
+	else
+	{
+		CreateInterior();
+	}
+
+	// Equipment is configured after creation, so it is created in every round
+	BeginRoundSnapshotEquipment();
 	CreateEquipment();
+	FinishRoundSnapshotEquipment();
+
+	// The landscape may have changed in ways that the visibility grid does not track,
+	// such as falling material, so the grid is created again when it is needed
+	ResetVisibilityGrid();
 
 	// Make map visible to everyone
 	UpdateFoW();
@@ -148,6 +189,12 @@ private func OnRoundStart(int round_number)
 	// Activate fog of war
 	UpdateFoW();
 
+	// Interior objects had time to settle
+	SettleRoundSnapshot();
+
+	// Particles are counted per round
+	ResetParticleCounters();
+
 	// Do the usual stuff
 	_inherited(round_number, ...);
 }
@@ -163,6 +210,13 @@ private func OnRoundEnd(int round_number)
 	// Disable fog of war
 	UpdateFoW(nil, nil, false);
 
+	// Log the profiler values and particle counters of this round
+	if (IsProfilerEnabled())
+	{
+		ProfileDump(true);
+		LogParticleCounters();
+	}
+
 	// Aaaand we're done!
 	GameOver();
 
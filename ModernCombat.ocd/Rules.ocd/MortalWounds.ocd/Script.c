@@ -84,16 +84,24 @@ local RuleMortalWoundsCheck = new Effect
 			this.Target.GetAlive = CMC_Rule_MortalWounds.GetAlive;
 			this.Target.GetEnergy = CMC_Rule_MortalWounds.GetEnergy;
 			this.Target.GetOCF = CMC_Rule_MortalWounds.GetOCF;
-			this.is_incapacitated = false;
+			SetIncapacitated(false);
 			this.death_timer = this.TimerMax;
 		}
 		return FX_OK;
 	},
 
+	Stop = func (int temp)
+	{
+		if (!temp && this.Target)
+		{
+			SetIncapacitated(false);
+		}
+		return FX_OK;
+	},
+
 	Timer = func ()
 	{
 		var change = +1;
-		var overlay = GetScreenOverlay();
 		// Already wounded?
 		if (IsIncapacitated())
 		{
@@ -109,11 +117,8 @@ local RuleMortalWoundsCheck = new Effect
 			{
 				this.Target->~PlaySoundHeartbeat();
 			}
-			if (overlay)
-			{
-				var alpha = InterpolateLinear(this.death_timer, 0, 230, this.TimerMax, 0);
-				overlay->Update({BackgroundColor = RGBa(1, 1, 1, alpha)});
-			}
+			var alpha = InterpolateLinear(this.death_timer, 0, 230, this.TimerMax, 0);
+			SetScreenOverlay(RGBa(1, 1, 1, alpha));
 
 			// Update the menu
 			if (this.Target->~GetIncapacitatedMenu())
@@ -123,10 +128,7 @@ local RuleMortalWoundsCheck = new Effect
 		}
 		else
 		{
-			if (overlay)
-			{
-				overlay->Update({BackgroundColor = nil});
-			}
+			SetScreenOverlay(nil);
 		}
 
 		this.death_timer = BoundBy(this.death_timer + change, 0, this.TimerMax);
@@ -147,7 +149,7 @@ local RuleMortalWoundsCheck = new Effect
 		else if (health_change < 0 && (health_change + 1000 * this.Target->GetEnergy() <= 0))
 		{
 			var stay_at_one_health = (1 - this.Target->GetEnergy()) * 1000;
-			this.is_incapacitated = true;
+			SetIncapacitated(true);
 			this.death_timer = Max(this.TimerMin, this.death_timer);
 			this.Target->~OnIncapacitated(health_change, cause, by_player);
 			if (this.Target->~GetHUDController()) // Update the HUD; Used OnCrewDisabled callback, because defining a new one is not worth the effort
@@ -163,14 +165,20 @@ local RuleMortalWoundsCheck = new Effect
 
 	IsIncapacitated = func ()
 	{
-		return this.is_incapacitated;
+		return this.Target.is_incapacitated;
+	},
+
+	// The state is stored in the target, so that the functions below do not have to look up the effect
+	SetIncapacitated = func (bool incapacitated)
+	{
+		this.Target.is_incapacitated = incapacitated;
 	},
 
 	DoReanimate = func (int by_player)
 	{
 		if (IsIncapacitated())
 		{	
-			this.is_incapacitated = false;
+			SetIncapacitated(false);
 			this.Target->~OnReanimated(by_player);
 			if (this.Target->~GetHUDController()) // Update the HUD; Used OnCrewEnabled callback, because defining a new one is not worth the effort
 			{
@@ -182,11 +190,11 @@ local RuleMortalWoundsCheck = new Effect
 	},
 
 	// Effects
-	GetScreenOverlay = func ()
+	SetScreenOverlay = func (int color)
 	{
 		if (this.Target->~GetHUDController())
 		{
-			return this.Target->GetHUDController()->~GetColorLayer(this.Target, Format("%v", CMC_Rule_MortalWounds));
+			this.Target->GetHUDController()->~SetColorLayer(this.Target, Format("%v", CMC_Rule_MortalWounds), color);
 		}
 	},
 
@@ -194,10 +202,10 @@ local RuleMortalWoundsCheck = new Effect
 
 /* --- Functions, are being added to clonks if the rule is active --- */
 
+// The property is maintained by the RuleMortalWoundsCheck effect
 func IsIncapacitated()
 {
-	var fx = GetEffect("RuleMortalWoundsCheck", this);
-	return fx && fx->IsIncapacitated();
+	return this.is_incapacitated;
 }
 
 func DoReanimate(int by_player)
@@ -208,7 +216,7 @@ func DoReanimate(int by_player)
 
 func GetAlive()
 {
-	if (this->~IsIncapacitated())
+	if (this.is_incapacitated)
 	{
 		return false;
 	}
@@ -227,7 +235,7 @@ func GetOCF()
 	var ocf = Call(this->GetID().GetOCF);
 
 	// Remove alive flag if incapacitated	
-	if (this->~IsIncapacitated() && (ocf & OCF_Alive))
+	if (this.is_incapacitated && (ocf & OCF_Alive))
 	{
 		return ocf - OCF_Alive;
 	}
@@ -239,7 +247,7 @@ func GetOCF()
 
 func GetEnergy()
 {	
-	if (this->~IsIncapacitated())
+	if (this.is_incapacitated)
 	{
 		return 0;
 	}
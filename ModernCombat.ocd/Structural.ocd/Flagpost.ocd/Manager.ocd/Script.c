@@ -0,0 +1,337 @@
+/**
+	Flag post manager
+
+	Evaluates all flag posts in a single timer, instead of
+	every flag post running its own timer and crew search.
+
+	Crew members near flag posts are found with one search
+	per frame and then distributed to the flag posts that
+	are due for evaluation. Visual updates of the flag posts
+	are spread over several frames.
+
+	The manager also counts how many flag posts each faction
+	controls, so that goals can query this without iterating
+	over all flag posts. It counts all flag posts, also the
+	ones that use their own timer.
+
+	Flag posts create the manager. If it is removed, the flag
+	posts fall back to their own timers until a new manager is
+	created, which takes over the existing flag posts.
+ */
+
+/* --- Properties --- */
+
+local Visibility = VIS_Editor;
+
+local flagposts;       // Array of {flag, interval, next, control, evaluate} entries
+local faction_control; // Number of fully captured flag posts, indexed by faction ID
+local visual_queue;    // Flag posts that are waiting for a visual update
+local is_disabled;     // Flag posts use their own timers if this is set
+
+local FlagPostManager_VisualUpdates = 2; // Maximum number of visual updates per frame
+
+/* --- Engine callbacks --- */
+
+func Initialize()
+{
+	if (ObjectCount(Find_ID(GetID())) > 1)
+	{
+		RemoveObject();
+		return;
+	}
+	flagposts = [];
+	faction_control = [];
+	visual_queue = [];
+	AddTimer(this.EvaluateFlagPosts, 1);
+
+	// Take over the flag posts of a removed manager
+	for (var flagpost in FindObjects(Find_Func("IsFlagpole")))
+	{
+		flagpost->~OnFlagPostManagerCreated(this);
+	}
+}
+
+
+func Destruction()
+{
+	// Flag posts fall back to their own timers
+	for (var entry in flagposts ?? [])
+	{
+		if (entry.flag)
+		{
+			entry.flag->~OnFlagPostManagerRemoved();
+		}
+	}
+}
+
+/* --- Interface --- */
+
+/**
+	Enables or disables the manager.
+	Flag posts that are created while the manager is
+	disabled use their own capture timer.
+
+	@par enabled {@code true} enables the manager.
+ */
+public func SetEnabled(bool enabled)
+{
+	if (GetType(this) == C4V_Def)
+	{
+		return GetManager()->SetEnabled(enabled);
+	}
+	else
+	{
+		is_disabled = !enabled;
+	}
+}
+
+
+public func IsEnabled()
+{
+	if (GetType(this) == C4V_Def)
+	{
+		return GetManager()->IsEnabled();
+	}
+	else
+	{
+		return !is_disabled;
+	}
+}
+
+
+/**
+	Registers a flag post, or changes its capture interval
+	if it is registered already.
+
+	@par flagpost The flag post.
+	@par interval The flag post is evaluated every {@code interval} frames.
+	@par evaluate {@code true} if the manager evaluates the flag post,
+	              otherwise it is only counted.
+ */
+public func AddFlagPost(object flagpost, int interval, bool evaluate)
+{
+	if (GetType(this) == C4V_Def)
+	{
+		return GetManager()->AddFlagPost(flagpost, interval, evaluate);
+	}
+	else
+	{
+		interval = Max(1, interval);
+		var entry = GetEntry(flagpost);
+		if (entry)
+		{
+			entry.interval = interval;
+			entry.next = FrameCounter() + interval;
+			entry.evaluate = evaluate;
+		}
+		else
+		{
+			PushBack(flagposts, {flag = flagpost, interval = interval, next = FrameCounter() + interval, evaluate = evaluate});
+		}
+	}
+}
+
+
+public func RemoveFlagPost(object flagpost)
+{
+	if (GetType(this) == C4V_Def)
+	{
+		var manager = FindObject(Find_ID(this));
+		if (manager)
+		{
+			manager->RemoveFlagPost(flagpost);
+		}
+	}
+	else
+	{
+		var entry = GetEntry(flagpost);
+		if (entry)
+		{
+			OnFlagPostControlChanged(flagpost, nil);
+			RemoveArrayValue(flagposts, entry);
+		}
+		RemoveArrayValue(visual_queue, flagpost);
+	}
+}
+
+
+/**
+	Gets all registered flag posts.
+ */
+public func GetFlagPosts()
+{
+	if (GetType(this) == C4V_Def)
+	{
+		return GetManager()->GetFlagPosts();
+	}
+	else
+	{
+		var list = [];
+		for (var entry in flagposts)
+		{
+			if (entry.flag)
+			{
+				PushBack(list, entry.flag);
+			}
+		}
+		return list;
+	}
+}
+
+
+/**
+	Gets the number of flag posts that are fully captured by a faction.
+
+	@par faction The faction.
+ */
+public func GetControlledFlagPostCount(proplist faction)
+{
+	if (GetType(this) == C4V_Def)
+	{
+		return GetManager()->GetControlledFlagPostCount(faction);
+	}
+	else
+	{
+		if (faction == nil)
+		{
+			return 0;
+		}
+		return faction_control[faction->GetID()] ?? 0;
+	}
+}
+
+
+/**
+	Checks whether a faction has captured all registered flag posts.
+
+	@par faction The faction.
+ */
+public func HasFullControl(proplist faction)
+{
+	if (GetType(this) == C4V_Def)
+	{
+		return GetManager()->HasFullControl(faction);
+	}
+	else
+	{
+		var count = GetLength(flagposts);
+		return count > 0 && GetControlledFlagPostCount(faction) == count;
+	}
+}
+
+/* --- Callbacks from flag posts --- */
+
+// Called by a flag post when it is fully captured or neutralized
+public func OnFlagPostControlChanged(object flagpost, proplist faction)
+{
+	if (GetType(this) == C4V_Def)
+	{
+		var manager = FindObject(Find_ID(this));
+		if (manager)
+		{
+			manager->OnFlagPostControlChanged(flagpost, faction);
+		}
+	}
+	else
+	{
+		var entry = GetEntry(flagpost);
+		if (!entry || entry.control == faction)
+		{
+			return;
+		}
+		if (entry.control)
+		{
+			faction_control[entry.control->GetID()] -= 1;
+		}
+		if (faction)
+		{
+			faction_control[faction->GetID()] += 1;
+		}
+		entry.control = faction;
+	}
+}
+
+
+// Called by a flag post when its flag and progress bar should be updated
+public func QueueVisualUpdate(object flagpost)
+{
+	if (GetType(this) == C4V_Def)
+	{
+		return GetManager()->QueueVisualUpdate(flagpost);
+	}
+	else if (!IsValueInArray(visual_queue, flagpost))
+	{
+		PushBack(visual_queue, flagpost);
+	}
+}
+
+/* --- Timer --- */
+
+func EvaluateFlagPosts()
+{
+	var frame = FrameCounter();
+
+	// Collect the flag posts that are due this frame
+	var due = [];
+	var search = [C4FO_Or];
+	for (var entry in flagposts)
+	{
+		if (!entry.flag || !entry.evaluate || frame < entry.next) continue;
+
+		entry.next = frame + entry.interval;
+		PushBack(due, entry.flag);
+		PushBack(search, Find_Distance(entry.flag->GetRange(), entry.flag->GetX() - GetX(), entry.flag->GetY() - GetY()));
+	}
+
+	// One crew search for all capture ranges
+	if (GetLength(due) > 0)
+	{
+		var candidates = FindObjects(Find_OCF(OCF_Alive), search);
+		for (var flagpost in due)
+		{
+			flagpost->EvaluateCapture(flagpost->GetCrewInRange(candidates));
+		}
+	}
+
+	// Update only a few visuals per frame
+	for (var i = 0; i < FlagPostManager_VisualUpdates && GetLength(visual_queue) > 0; ++i)
+	{
+		var flagpost = PopFront(visual_queue);
+		if (flagpost)
+		{
+			flagpost->UpdateFlag();
+		}
+	}
+}
+
+/* --- Internals --- */
+
+func GetEntry(object flagpost)
+{
+	for (var entry in flagposts)
+	{
+		if (entry.flag == flagpost)
+		{
+			return entry;
+		}
+	}
+	return nil;
+}
+
+
+/**
+	Gets the manager, and creates it if there is none.
+ */
+public func GetManager()
+{
+	AssertDefinitionContext();
+	var manager = FindObject(Find_ID(this));
+	if (manager)
+	{
+		return manager;
+	}
+	else
+	{
+		return CreateObject(this);
+	}
+}
@@ -12,6 +12,7 @@ local range_marker;
 local capture_faction;
 local capture_progress;
 local capture_range;
+local capture_speed;
 local capture_trend;
 local attacking_faction;
 local attacking_crew;
@@ -21,6 +22,8 @@ local has_deployment;
 
 local last_owner;
 local is_captured;
+local is_managed;      // Evaluated by CMC_FlagPostManager instead of an own timer
+local icon_state;
 
 
 local FlagPost_DefaultRange = 100;
@@ -47,7 +50,7 @@ public func GetDeployLocation()
 	if (has_deployment && !deploy_location)
 	{
 		deploy_location = CreateObject(CMC_DeployLocation, 0, -50, NO_OWNER);
-		deploy_location->AddCondition(DefineCallback(this.IsAvailableForDeployment));
+		deploy_location->AddCondition(BindCallback(this.IsAvailableForDeployment));
 	}
 	return deploy_location;
 }
@@ -62,8 +65,9 @@ public func SetCaptureRange(int value)
 
 public func SetCaptureSpeed(int value)
 {
-	RemoveTimer(this.CaptureTimer);
-	AddTimer(this.CaptureTimer, value ?? FlagPost_DefaultSpeed);
+	capture_speed = value ?? FlagPost_DefaultSpeed;
+	CMC_FlagPostManager->AddFlagPost(this, capture_speed, is_managed);
+	UpdateCaptureTimer();
 	return this;
 }
 
@@ -91,6 +95,7 @@ func Initialize()
 	attacking_crew = [];
 	last_owner = nil;
 	has_deployment = true;
+	is_managed = CMC_FlagPostManager->GetManager()->IsEnabled();
 
 	SetCaptureRange();
 	SetCaptureSpeed();
@@ -104,6 +109,7 @@ func Initialize()
 
 func Destruction()
 {
+	CMC_FlagPostManager->RemoveFlagPost(this);
 	if (deploy_location)
 	{
 		deploy_location->RemoveObject();
@@ -125,13 +131,55 @@ public func SetPosition(int x, int y, bool check_bounds)
 	return inherited(x, y, check_bounds, ...);
 }
 
+/* --- Callbacks from the flag post manager --- */
+
+// Called by a new manager, e.g. after the previous manager was removed
+public func OnFlagPostManagerCreated(object manager)
+{
+	if (capture_speed == nil) // Still initializing, registers itself
+	{
+		return;
+	}
+	is_managed = manager->IsEnabled();
+	manager->AddFlagPost(this, capture_speed, is_managed);
+	manager->OnFlagPostControlChanged(this, GetControllingFaction());
+	UpdateCaptureTimer();
+}
+
+
+// Called by the manager when it is removed, the flag post is evaluated by its own timer then
+public func OnFlagPostManagerRemoved()
+{
+	is_managed = false;
+	UpdateCaptureTimer();
+}
+
 /* --- Capturing logic --- */
 
+// Flag posts that are not evaluated by the manager have their own timer
+func UpdateCaptureTimer()
+{
+	RemoveTimer(this.CaptureTimer);
+	if (!is_managed)
+	{
+		AddTimer(this.CaptureTimer, capture_speed);
+	}
+}
+
+
 func CaptureTimer()
 {
+	EvaluateCapture(GetCrewInRange());
+}
+
+
+// Called by the timer, or by the flag post manager
+public func EvaluateCapture(array crew_in_range)
+{
+	ProfileBegin("FlagPost::EvaluateCapture");
+
 	// Update attackers that are not in range; The system is a little strange though
 	// the attackers should not need concatenation at all, see UpdateAttackingCrew
-	var crew_in_range = GetCrewInRange();
 	CheckAttackingCrew(crew_in_range);
 
 	var friends_in_range = [];
@@ -177,6 +225,8 @@ func CaptureTimer()
 
 	UpdateStatusDisplay(has_enemies, has_friends);
 	UpdateAttackingCrew(enemies_in_range, friends_in_range);
+
+	ProfileEnd("FlagPost::EvaluateCapture");
 }
 
 
@@ -295,9 +345,10 @@ public func /* check */ DoProgress(proplist faction, int amount)
 		attacking_faction = nil;
 		is_captured = false;
 		capture_faction = faction;
+		UpdateControl();
 	}
 
-	UpdateFlag();
+	RequestFlagUpdate();
 
 	if (capture_progress >= 100)
 	{
@@ -314,9 +365,29 @@ public func /* check */ DoProgress(proplist faction, int amount)
 /* --- Status --- */
 
 
-public func GetCrewInRange()
+// Searches for crew in range, or filters the given candidates by range
+public func GetCrewInRange(array candidates)
 {
-	var crew = FindObjects(Find_Distance(capture_range), Find_OCF(OCF_Alive));
+	var crew;
+	if (candidates)
+	{
+		crew = [];
+		var range_squared = capture_range * capture_range;
+		for (var member in candidates)
+		{
+			if (!member) continue;
+			var dx = member->GetX() - GetX();
+			var dy = member->GetY() - GetY();
+			if (dx * dx + dy * dy <= range_squared)
+			{
+				PushBack(crew, member);
+			}
+		}
+	}
+	else
+	{
+		crew = FindObjects(Find_Distance(capture_range), Find_OCF(OCF_Alive));
+	}
 	for (var i = 0; i < GetLength(crew); ++i)
 	{
 		var member = crew[i];
@@ -379,6 +450,7 @@ func DoCapture(proplist faction, bool silent)
 	}
 	attacking_crew = [];
 	last_owner = capture_faction; // FIXME: This should be done BEFORE reassigning the team...
+	UpdateControl();
 	UpdateFlag();
 }
 
@@ -389,18 +461,55 @@ func SetNeutral() // Used only by MoveFlagpost, so might be removed
 	capture_progress = 0;
 	attacking_faction = nil;
 	is_captured = false;
+	UpdateControl();
 	UpdateFlag();
 }
 
+
+// Informs the manager about the faction that fully controls the flag post;
+// The manager counts all flag posts, also those that have their own timer
+func UpdateControl()
+{
+	CMC_FlagPostManager->OnFlagPostControlChanged(this, GetControllingFaction());
+}
+
+
+// The faction that fully controls the flag post, or nil
+func GetControllingFaction()
+{
+	if (is_captured)
+	{
+		return capture_faction;
+	}
+	return nil;
+}
+
 /* --- Display --- */
 
 func SetIconState(id state, proplist faction)
 {
+	if (icon_state == state) return;
+	icon_state = state;
+
 	SetGraphics(nil, state, 1, GFXOV_MODE_IngamePicture);
 	SetObjDrawTransform(500, 0, 0, 0, 500, 1000 * (GetID()->GetDefOffset(1) - 30), 1);
 }
 
-func UpdateFlag()
+// Managed flag posts are updated by the manager, spread over several frames
+func RequestFlagUpdate()
+{
+	if (is_managed)
+	{
+		CMC_FlagPostManager->QueueVisualUpdate(this);
+	}
+	else
+	{
+		UpdateFlag();
+	}
+}
+
+
+public func UpdateFlag()
 {
 	if (!flag) return;
 
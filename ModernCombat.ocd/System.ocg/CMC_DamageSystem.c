@@ -17,6 +17,8 @@ static const FxCmcDamageSystem = new Effect
 
 	Damage = func (int health_change_exact, int cause, int by_player)
 	{
+		ProfileBegin("FxCmcDamageSystem::Damage");
+
 		// Color the screen red
 		if (Target->GetAlive() && health_change_exact < 0)
 		{
@@ -26,6 +28,7 @@ static const FxCmcDamageSystem = new Effect
 			AddBloodEffect(Abs(health_change_exact), cause, by_player);
 		}
 
+		ProfileEnd("FxCmcDamageSystem::Damage");
 		return health_change_exact;
 	},
 
@@ -48,11 +51,7 @@ static const FxCmcDamageSystem = new Effect
 		var intensity_max = 160;
 		var intensity = BoundBy(damage / 200, 0, intensity_max);
 		var duration = BoundBy(damage / 1000, 15, 45);
-		var flash = Target->CreateEffect(FxFlashScreenRGBa, 200, 1, "PlayerDamaged", RGB(255, 0, 0), intensity, duration);
-		if (flash)
-		{
-			flash.AlphaMax = intensity_max;
-		}
+		Target->FlashScreen("PlayerDamaged", RGB(255, 0, 0), intensity, duration, intensity_max);
 	},
 
 	AddSoundEffect = func (int damage, int cause, int by_player)
@@ -141,6 +140,55 @@ static const FxCmcBloodBurst = new Effect
 		return RandomX(-range_y, +range_y);
 	},
 
+	// Gets a cached particle definition; The color is reduced to steps of 8, so that the definitions can be reused
+	GetParticles = func (string kind, proplist color, int size)
+	{
+		var r = color.R / 8 * 8, g = color.G / 8 * 8, b = color.B / 8 * 8;
+		var key = Format("%s:%d:%d", kind, RGB(r, g, b), size);
+		var particles = GetParticleDefinition(key);
+		if (particles)
+		{
+			return particles;
+		}
+		if (kind == "BloodBurst")
+		{
+			particles = 
+			{
+			    Size = size,
+				Phase = PV_Linear(0, 15),
+				Alpha = 255,
+				R = r, G = g, B = b,
+				DampingX = 500,
+				DampingY = 500,
+				Attach = ATTACH_Front, 
+			};
+		}
+		else if (kind == "BloodSplatter")
+		{
+			particles =
+			{
+				Size = size,
+				Phase = PV_Random(0, 2),
+				Rotation = PV_Random(0, 360),
+				Alpha = PV_KeyFrames(0, 0, 0, 50, 200, 800, 200, 1000, 0),
+				R = r, G = g, B = b,
+				Attach = ATTACH_Back,
+			};
+		}
+		else
+		{
+			particles =
+			{
+				Size = size,
+				Phase = PV_Random(0, 3),
+				Alpha = PV_KeyFrames(0, 0, 0, 50, 200, 800, 200, 1000, 0),
+				R = r, G = g, B = b,
+				Attach = ATTACH_Back,
+			};
+		}
+		return StoreParticleDefinition(key, particles);
+	},
+
 	IsSky = func(int x, int y)
 	{
 		var material = Target->GetMaterial(x, y);
@@ -163,20 +211,15 @@ static const FxCmcBloodBurst = new Effect
 		// Burst / spray
 		var burst_angle = Normalize(angle - 90 + RandomX(-5, 5), 0);
 		var	burst_color = GetBloodColorLight();
-		Target->CreateParticle("BloodBurst", x ?? GetRandomX(), y ?? GetRandomY(), PV_Random(0, this.XDir / 5), PV_Random(0, this.YDir / 5), RandomX(20, 30), 
+		var burst_x = x ?? GetRandomX();
+		var burst_y = y ?? GetRandomY();
+		if (Target->RequestParticles("BloodBurst", 1, PARTICLE_Priority_Normal, burst_x, burst_y))
 		{
-		    Size = size,
-			Phase = PV_Linear(0, 15),
-			Rotation = burst_angle,
-			Alpha = 255,
-			R = burst_color.R, G = burst_color.G, B = burst_color.B,
-			DampingX = 500,
-			DampingY = 500,
-			Attach = ATTACH_Front, 
-		});
+			Target->CreateParticle("BloodBurst", burst_x, burst_y, PV_Random(0, this.XDir / 5), PV_Random(0, this.YDir / 5), RandomX(20, 30), {Prototype = GetParticles("BloodBurst", burst_color, size), Rotation = burst_angle});
+		}
 
-		// Splatter on the background
-		if (!IsSky(x, y))
+		// Splatter on the background, stays visible for some time
+		if (!IsSky(x, y) && Target->RequestParticles("BloodSplatter", 1, PARTICLE_Priority_High, x, y))
 		{
 			var lifetime = RandomX(240, 360);
 			var splat_color = GetBloodColor();
@@ -188,15 +231,7 @@ static const FxCmcBloodBurst = new Effect
 			if (this.Cause == FX_Call_EngBlast || size > 20)
 			{
 				splat->
-				CreateParticle("BloodSplatter", x, y, 0, 0, lifetime,
-				{
-					Size = size,
-					Phase = PV_Random(0, 2),
-					Rotation = PV_Random(0, 360),
-					Alpha = PV_KeyFrames(0, 0, 0, 50, 200, 800, 200, 1000, 0),
-					R = splat_color.R, G = splat_color.G, B = splat_color.B,
-					Attach = ATTACH_Back,
-				});
+				CreateParticle("BloodSplatter", x, y, 0, 0, lifetime, GetParticles("BloodSplatter", splat_color, size));
 			}
 			else
 			{
@@ -204,15 +239,7 @@ static const FxCmcBloodBurst = new Effect
 				var radius = RandomX(2, 5) + size / 2; // Factor in the particle rotation
 
 				splat->
-				CreateParticle("BloodSplatter2", x + Sin(splat_angle, radius), y - Cos(splat_angle, radius), 0, 0, lifetime,
-				{
-					Size = size,
-					Phase = PV_Random(0, 3),
-					Rotation = splat_angle,
-					Alpha = PV_KeyFrames(0, 0, 0, 50, 200, 800, 200, 1000, 0),
-					R = splat_color.R, G = splat_color.G, B = splat_color.B,
-					Attach = ATTACH_Back,
-				});
+				CreateParticle("BloodSplatter2", x + Sin(splat_angle, radius), y - Cos(splat_angle, radius), 0, 0, lifetime, {Prototype = GetParticles("BloodSplatter2", splat_color, size), Rotation = splat_angle});
 			}
 		}
 	}
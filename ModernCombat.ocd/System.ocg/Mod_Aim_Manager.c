@@ -5,34 +5,124 @@
 // Further modify to accomodate for prone aiming
 
 local aim_cancel_on_jump;
+local aim_schedule_frame, aim_schedule_frame2; // The aim schedules are called in these frames
+local aim_procedure_changed;                   // The procedure is checked again in the next tick
 
-func FxIntAimCheckProcedureTimer()
+/* --- Aim system manager --- */
+
+// All aiming clonks are ticked by one effect, instead of a timer effect in every clonk.
+static aim_system_manager; // {Crew = [clonks], Helper = object}
+
+
+func AddToAimSystemManager()
 {
-	// Care about the aim schedules
-	if(aim_schedule_timer != nil)
+	if (!aim_system_manager)
 	{
-		aim_schedule_timer--;
-		if(aim_schedule_timer == 0)
-		{
-			Call(aim_schedule_call);
-			aim_schedule_call = nil;
-			aim_schedule_timer = nil;
-		}
+		aim_system_manager = {Crew = []};
+	}
+	if (!aim_system_manager.Helper)
+	{
+		aim_system_manager.Helper = CreateObject(Dummy, 0, 0, NO_OWNER);
+	}
+	if (!IsValueInArray(aim_system_manager.Crew, this))
+	{
+		PushBack(aim_system_manager.Crew, this);
 	}
-	if(aim_schedule_timer2 != nil)
+	aim_procedure_changed = true;
+	GetEffect("FxAimSystemManager", aim_system_manager.Helper) ?? aim_system_manager.Helper->CreateEffect(FxAimSystemManager, 1, 1);
+}
+
+
+// Registers the clonk again on every action, because the helper may have been removed, e.g. by a cleanup of all objects
+func EnsureAimSystemManager()
+{
+	if (GetEffect("IntAimCheckProcedure", this))
 	{
-		aim_schedule_timer2--;
-		if(aim_schedule_timer2 == 0)
+		AddToAimSystemManager();
+	}
+}
+
+
+func RemoveFromAimSystemManager()
+{
+	if (aim_system_manager)
+	{
+		RemoveArrayValue(aim_system_manager.Crew, this);
+	}
+}
+
+
+static const FxAimSystemManager = new Effect
+{
+	Timer = func ()
+	{
+		// Clonks may leave the manager during the tick, so check every clonk against the current list
+		for (var clonk in aim_system_manager.Crew[:])
 		{
-			Call(aim_schedule_call2);
-			aim_schedule_call2 = nil;
-			aim_schedule_timer2 = nil;
+			if (clonk && IsValueInArray(aim_system_manager.Crew, clonk))
+			{
+				clonk->AimSystemTick();
+			}
+		}
+		RemoveHoles(aim_system_manager.Crew);
+		if (GetLength(aim_system_manager.Crew) == 0)
+		{
+			return FX_Execute_Kill;
 		}
+		return FX_OK;
+	},
+};
+
+
+// Modify the aim procedure check, to cancel aiming on certain other events
+// if wanted.
+// Further modify to accomodate for prone aiming
+func AimSystemTick()
+{
+	// Schedules are due in the frame in which the countdown of the original
+	// aim manager reached 0; it counted down in the frame of the call, too.
+	// Convert countdowns that were set by the original aim manager.
+	if (aim_schedule_timer != nil)
+	{
+		aim_schedule_frame = FrameCounter() + aim_schedule_timer - 1;
+		aim_schedule_timer = nil;
+	}
+	if (aim_schedule_timer2 != nil)
+	{
+		aim_schedule_frame2 = FrameCounter() + aim_schedule_timer2 - 1;
+		aim_schedule_timer2 = nil;
+	}
+
+	// Care about the aim schedules
+	if (aim_schedule_frame != nil && FrameCounter() >= aim_schedule_frame)
+	{
+		Call(aim_schedule_call);
+		aim_schedule_call = nil;
+		aim_schedule_frame = nil;
+	}
+	if (aim_schedule_frame2 != nil && FrameCounter() >= aim_schedule_frame2)
+	{
+		Call(aim_schedule_call2);
+		aim_schedule_call2 = nil;
+		aim_schedule_frame2 = nil;
 	}
 
-	// check procedure
+	// Check procedure: Hand and carry state can change without an action change,
+	// so this is checked in every tick
 	if(!ReadyToAction() && aim_type != WEAPON_AIM_TYPE_PRONE)
 		PauseAim();
+
+	// The action is checked only if it changed
+	if (aim_procedure_changed)
+	{
+		aim_procedure_changed = false;
+		CheckAimAction();
+	}
+}
+
+
+func CheckAimAction()
+{
 	if (aim_type == WEAPON_AIM_TYPE_PRONE)
 		if (this->GetAction() != "Crawl")
 			return CancelAiming();
@@ -43,9 +133,35 @@ func FxIntAimCheckProcedureTimer()
 				this->CancelAiming();
 }
 
+
+func FxIntAimCheckProcedureStop(object target, effect, int reason, bool temp)
+{
+	_inherited(target, effect, reason, temp);
+
+	if (!temp)
+	{
+		RemoveFromAimSystemManager();
+	}
+}
+
+
+func OnActionChanged(string old_action)
+{
+	aim_procedure_changed = true;
+	return _inherited(old_action, ...);
+}
+
+
+func Entrance(object container)
+{
+	aim_procedure_changed = true;
+	return _inherited(container, ...);
+}
+
 public func SetCancelOnJump(bool cancel)
 {
 	aim_cancel_on_jump = cancel;
+	aim_procedure_changed = true;
 }
 
 func PauseAim()
@@ -84,19 +200,21 @@ public func StartLoad(object weapon, string type)
 		// Apply the set
 		ApplySet(aim_set);
 
-		// Add effect to ensure procedure
-		AddEffect("IntAimCheckProcedure", this, 1,  1, this);
+		// Add effect to ensure procedure, it is ticked by the aim system manager
+		AddEffect("IntAimCheckProcedure", this, 1, 0, this);
 	}
+	EnsureAimSystemManager();
+	aim_procedure_changed = true;
 
 	if(aim_set["AnimationLoad"] != nil)
 		PlayAnimation(aim_set["AnimationLoad"], CLONK_ANIM_SLOT_Arms, Anim_Linear(0, 0, GetAnimationLength(aim_set["AnimationLoad"]), aim_set["LoadTime"], ANIM_Remove), Anim_Const(1000));
 
-	aim_schedule_timer = aim_set["LoadTime"];
+	aim_schedule_frame = FrameCounter() + aim_set["LoadTime"] - 1;
 	aim_schedule_call  = "StopLoad";
 
 	if(aim_set["LoadTime2"] != nil)
 	{
-		aim_schedule_timer2 = aim_set["LoadTime2"];
+		aim_schedule_frame2 = FrameCounter() + aim_set["LoadTime2"] - 1;
 		aim_schedule_call2  = "DuringLoad";
 	}
 }
@@ -122,9 +240,11 @@ public func StartAim(object weapon, int angle, string type)
 		// Apply the set
 		ApplySet(aim_set);
 
-		// Add effect to ensure procedure
-		AddEffect("IntAimCheckProcedure", this, 1,  1, this);
+		// Add effect to ensure procedure, it is ticked by the aim system manager
+		AddEffect("IntAimCheckProcedure", this, 1, 0, this);
 	}
+	EnsureAimSystemManager();
+	aim_procedure_changed = true;
 
 	if(aim_set["AnimationAim"] != nil)
 	{
@@ -161,9 +281,11 @@ public func StartShoot(object weapon, string type)
 		// Applay the set
 		ApplySet(aim_set);
 
-		// Add effect to ensure procedure
-		AddEffect("IntAimCheckProcedure", this, 1,  1, this);
+		// Add effect to ensure procedure, it is ticked by the aim system manager
+		AddEffect("IntAimCheckProcedure", this, 1, 0, this);
 	}
+	EnsureAimSystemManager();
+	aim_procedure_changed = true;
 
 	if(aim_set["AnimationShoot"] != nil)
 	{
@@ -197,12 +319,12 @@ public func StartShoot(object weapon, string type)
 		}
 	}
 
-	aim_schedule_timer = aim_set["ShootTime"];
+	aim_schedule_frame = FrameCounter() + aim_set["ShootTime"] - 1;
 	aim_schedule_call  = "StopShoot";
 
 	if(aim_set["ShootTime2"] != nil)
 	{
-		aim_schedule_timer2 = aim_set["ShootTime2"];
+		aim_schedule_frame2 = FrameCounter() + aim_set["ShootTime2"] - 1;
 		aim_schedule_call2  = "DuringShoot";
 	}
 }
@@ -248,13 +370,21 @@ func FxIntAimTimer(target, effect, time)
 	var die = _inherited(target, effect, time);
 	if (die == -1) // X_X
 		return FX_Execute_Kill;
-	// Check if a view offset is set
+	// Aiming clonks wait for the schedules of the manager, so it must exist
+	if (!aim_system_manager || !aim_system_manager.Helper)
+		EnsureAimSystemManager();
+	// Check if a view offset is set, and update it only if it differs from the current offset;
+	// This also restores the offset if something else reset it
 	if (effect.view_offset)
 	{
 		var offset = BoundBy(effect.view_offset, effect.view_offset_min ?? 0, effect.view_offset_max ?? 0);
 		var x_offset = +Sin(this.aim_angle, offset);
 		var y_offset = -Cos(this.aim_angle, offset);
-		SetViewOffset(this->GetOwner(), x_offset, y_offset);
+		var current = GetPlayerViewOffset(this->GetOwner());
+		if (x_offset != current.X || y_offset != current.Y)
+		{
+			SetViewOffset(this->GetOwner(), x_offset, y_offset);
+		}
 	}
 }
 
@@ -278,6 +408,8 @@ public func ResetHands()
 
 	aim_cancel_on_jump = nil;
 	aim_type = nil;
+	aim_schedule_frame = nil;
+	aim_schedule_frame2 = nil;
 }
 
 // Modify to accept a change of aiming stances
@@ -286,6 +418,7 @@ public func ChangeAim(object weapon, string type)
 {
 	// New type
 	aim_type = type;
+	aim_procedure_changed = true;
 	// New aim set
 	aim_set = weapon->~GetAnimationSet(this);
 	ApplySet(aim_set);
@@ -0,0 +1,13 @@
+/**
+	Make clonks react to battlefield border zones.
+*/
+
+#appendto Clonk
+
+// Add the zone tracker, if there are any zones; the border manager exists only while there are zones
+func Construction(object creator)
+{
+	_inherited(creator, ...);
+
+	BattlefieldBorderManager->AddTracker(this);
+}
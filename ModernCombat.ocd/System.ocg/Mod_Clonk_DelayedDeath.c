@@ -43,12 +43,11 @@ func OnIncapacitated(int health_change, int cause, int by_player)
 	// Add symbol
 	PlayerMessage(GetOwner(), "@{{Icon_Skull}}");
 	// Flash screen
-	CreateEffect(FxFlashScreenRGBa, 200, 1, "FlashIncapacitated", RGB(255, 0, 0), 120, 40);
+	FlashScreen("FlashIncapacitated", RGB(255, 0, 0), 120, 40);
 	// Permanent red color
 	if (this->GetHUDController())
 	{
-		var overlay = this->GetHUDController()->~GetColorLayer(this, "IncapacitatedAmbience");
-		if (overlay) overlay->Update({BackgroundColor = RGBa(255, 0, 0, 40)});
+		this->GetHUDController()->~SetColorLayer(this, "IncapacitatedAmbience", RGBa(255, 0, 0, 40));
 	}
 	// Sound
 	this->~PlaySoundDamageIncapacitated();
@@ -64,11 +63,10 @@ func OnReanimated(int by_player)
 	// Remove screen effect
 	if (this->GetHUDController())
 	{
-		var overlay = this->GetHUDController()->~GetColorLayer(this, "IncapacitatedAmbience");
-		if (overlay) overlay->Update({BackgroundColor = nil});
+		this->GetHUDController()->~SetColorLayer(this, "IncapacitatedAmbience", nil);
 	}
 	// Add a whiteish flash
-	CreateEffect(FxFlashScreenRGBa, 200, 1, "FlashReanimated", RGB(255, 255, 255), 200, 40);
+	FlashScreen("FlashReanimated", RGB(255, 255, 255), 200, 40);
 	// Remove symbol
 	PlayerMessage(GetOwner(), "");
 	// Get up!
@@ -143,6 +143,7 @@ public func IsRelaunchBlocked()
 	Callback from the relaunch timer.
 
 	By default this displays the remaining time as a message above the container.
+	Also prepares the items of the crew, so that the relaunch itself is quick.
 
 	@par frames This many frames are remaining.
  */
@@ -152,6 +153,10 @@ public func OnTimeRemaining(int frames)
 	{
 		GetRespawnMenu()->GetRespawnButton()->OnTimeRemaining(frames);
 	}
+	if (GetRelaunchCrew())
+	{
+		GetRelaunchCrew()->~PrepareCrewLoadout();
+	}
 }
 
 
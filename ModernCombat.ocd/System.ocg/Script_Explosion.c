@@ -37,20 +37,313 @@ global func Explosion(array radius_stages, array damage_stages, bool silent, boo
 		FatalError("Damage and radius arrays must be of equal length");
 	}
 	var accumulated_damage = 0;
+	var stages = [];
 	for (var i = length; i >= 0; --i)
 	{
 		var damage = damage_stages[i] - accumulated_damage;
 		accumulated_damage += damage;
 
-		if (i > 0)
+		if (Contained())
 		{
-			BlastObjects(GetX(), GetY(), radius_stages[i], Contained(), GetController(), damage * multiplier, GetObjectLayer(), nil, true);
+			if (i > 0)
+			{
+				BlastObjects(GetX(), GetY(), radius_stages[i], Contained(), GetController(), damage * multiplier, GetObjectLayer(), nil, true);
+			}
+			else
+			{
+				Explode(radius_stages[i], silent, damage * multiplier);
+			}
 		}
 		else
 		{
-			Explode(radius_stages[i], silent, damage * multiplier);
+			PushBack(stages, [radius_stages[i], damage * multiplier]);
 		}
 	}
+
+	// Explosions outside of containers are resolved together with the other explosions of this frame
+	if (!Contained())
+	{
+		var level = radius_stages[0];
+		EnqueueBlast(stages, level, level, level, silent);
+		RemoveObject();
+	}
+}
+
+/* --- Explosion queue --- */
+
+static const EXPLOSION_MergeDistance = 10; // Blasts closer than this share one shockwave and one explosion effect
+static const EXPLOSION_MaxChain = 10;      // Resolve at most this many chained waves of blasts per frame
+
+static explosion_queue; // Queued blasts and counters, see GetExplosionQueue()
+
+/**
+	Adds a blast at the position of the calling object to the explosion queue.
+	All blasts of a frame are resolved together at the end of the same frame,
+	after all objects were executed: Objects are searched once for all blasts, blasts at the same position
+	have a single shockwave and explosion effect. Damage is still dealt
+	by every blast, with the controller of the calling object.
+
+	@par stages The damage stages, e.g. [[30, 20], [15, 40]]: Objects in the radius
+	            of a stage get half of the damage, objects at the center get the full damage.
+	@par shockwave The radius of the shockwave, 0 for no shockwave.
+	@par dig The radius of the blasted landscape, 0 for no blasting.
+	@par effect The level of the explosion effect, 0 for no effect.
+	@par silent If set to {@code true} there will be no sound.
+ */
+global func EnqueueBlast(array stages, int shockwave, int dig, int effect, bool silent)
+{
+	AssertObjectContext();
+
+	var blast =
+	{
+		X = GetX(),
+		Y = GetY(),
+		Controller = GetController(),
+		Layer = GetObjectLayer(),
+		Stages = stages ?? [],
+		Shockwave = shockwave,
+		Dig = dig,
+		Effect = effect,
+		Silent = silent,
+	};
+
+	// Objects with their own explosion effect create it right away
+	if (effect > 0 && this.ExplosionEffect)
+	{
+		this->ExplosionEffect(effect, 0, 0, 0, silent, effect);
+		blast.Effect = 0;
+	}
+
+	var queue = GetExplosionQueue();
+	queue.counters.blasts += 1;
+	if (queue.disabled)
+	{
+		queue.helper->ResolveBlasts([blast]);
+	}
+	else
+	{
+		PushBack(queue.blasts, blast);
+		// Global effects are executed after the objects, so this resolves the queue in the current frame
+		if (!GetEffect("FxExplosionQueue"))
+		{
+			Global->CreateEffect(FxExplosionQueue, 1, 1);
+		}
+	}
+}
+
+
+/**
+	Resolves all queued blasts right away.
+
+	Blasts may detonate other explosives, which queue their blasts
+	while the queue is being resolved. These are resolved, too, up to
+	{@code EXPLOSION_MaxChain} waves. Blasts of longer chains stay
+	in the queue for the next frame.
+
+	@return bool {@code true} if blasts are left in the queue.
+ */
+global func ResolveExplosionQueue()
+{
+	var queue = GetExplosionQueue();
+	for (var wave = 0; wave < EXPLOSION_MaxChain && GetLength(queue.blasts) > 0; ++wave)
+	{
+		var blasts = queue.blasts;
+		queue.blasts = [];
+		queue.helper->ResolveBlasts(blasts);
+	}
+	return GetLength(queue.blasts) > 0;
+}
+
+
+/**
+	Enables or disables the explosion queue.
+	Every blast is resolved on its own, right away, while it is disabled.
+ */
+global func SetExplosionQueue(bool enabled)
+{
+	GetExplosionQueue().disabled = !enabled;
+}
+
+
+/**
+	Gets the counters of the explosion queue: {blasts, searches, shockwaves, effects}
+ */
+global func GetExplosionQueueCounters()
+{
+	var counters = GetExplosionQueue().counters;
+	return {blasts = counters.blasts, searches = counters.searches, shockwaves = counters.shockwaves, effects = counters.effects};
+}
+
+
+global func GetExplosionQueue()
+{
+	if (!explosion_queue)
+	{
+		explosion_queue = {blasts = [], disabled = false, counters = {blasts = 0, searches = 0, shockwaves = 0, effects = 0}};
+	}
+	if (!explosion_queue.helper)
+	{
+		// Blasts are resolved in the context of this object, at the landscape origin
+		explosion_queue.helper = CreateObject(Dummy, 0, 0, NO_OWNER);
+		explosion_queue.helper->SetPosition(0, 0);
+	}
+	return explosion_queue;
+}
+
+
+static const FxExplosionQueue = new Effect
+{
+	Timer = func ()
+	{
+		if (ResolveExplosionQueue())
+		{
+			return FX_OK;
+		}
+		return FX_Execute_Kill;
+	},
+};
+
+
+// Deals the damage of all blasts, and creates the shockwaves, landscape blasting and effects
+global func ResolveBlasts(array blasts)
+{
+	if (GetLength(blasts) == 0) return;
+
+	ProfileBegin("Explosion::ResolveBlasts");
+	var counters = GetExplosionQueue().counters;
+
+	// Group blasts at the same position
+	var groups = [];
+	for (var blast in blasts)
+	{
+		var added = false;
+		for (var group in groups)
+		{
+			if (group[0].Layer == blast.Layer && Distance(group[0].X, group[0].Y, blast.X, blast.Y) <= EXPLOSION_MergeDistance)
+			{
+				PushBack(group, blast);
+				added = true;
+				break;
+			}
+		}
+		if (!added)
+		{
+			PushBack(groups, [blast]);
+		}
+	}
+
+	// One search for all blasts
+	var areas = [C4FO_Or];
+	for (var blast in blasts)
+	{
+		for (var stage in blast.Stages)
+		{
+			PushBack(areas, Find_Distance(stage[0], AbsX(blast.X), AbsY(blast.Y)));
+			PushBack(areas, Find_AtRect(AbsX(blast.X - 5), AbsY(blast.Y - 5), 10, 10));
+		}
+	}
+	if (GetLength(areas) > 1)
+	{
+		counters.searches += 1;
+		var targets = FindObjects(areas, Find_NoContainer(), Find_AnyLayer());
+		for (var blast in blasts)
+		{
+			for (var target in targets)
+			{
+				var damage = GetBlastDamage(blast, target);
+				if (target && damage > 0)
+				{
+					target->BlastObject(damage, blast.Controller);
+				}
+			}
+		}
+	}
+
+	for (var group in groups)
+	{
+		// The strongest blast is the center of the group
+		var center = group[0];
+		var shockwave = 0;
+		var effect = 0;
+		var silent = true;
+		for (var blast in group)
+		{
+			shockwave += blast.Shockwave * blast.Shockwave;
+			if (blast.Shockwave > center.Shockwave)
+			{
+				center = blast;
+			}
+			if (blast.Effect > 0)
+			{
+				effect = Max(effect, blast.Effect);
+				silent = silent && blast.Silent;
+			}
+		}
+
+		// Shockwaves add up with their energy
+		if (shockwave > 0)
+		{
+			counters.shockwaves += 1;
+			DoShockwave(center.X, center.Y, Sqrt(shockwave), center.Controller, center.Layer);
+		}
+
+		// Landscape, only if it was not blasted by a larger blast
+		for (var i = 0; i < GetLength(group); ++i)
+		{
+			var blast = group[i];
+			if (blast.Dig <= 0) continue;
+
+			var covered = false;
+			for (var j = 0; j < GetLength(group); ++j)
+			{
+				var other = group[j];
+				if (i != j && Distance(other.X, other.Y, blast.X, blast.Y) + blast.Dig <= other.Dig && (other.Dig > blast.Dig || j < i))
+				{
+					covered = true;
+					break;
+				}
+			}
+			if (!covered)
+			{
+				BlastFree(AbsX(blast.X), AbsY(blast.Y), blast.Dig, blast.Controller);
+			}
+		}
+
+		// One effect and sound for the group
+		if (effect > 0)
+		{
+			counters.effects += 1;
+			ExplosionEffect(effect, AbsX(center.X), AbsY(center.Y), 0, silent, effect);
+		}
+	}
+	ProfileEnd("Explosion::ResolveBlasts");
+}
+
+
+// Damage like in BlastObjects(): full damage at the center, half damage in the radius
+global func GetBlastDamage(proplist blast, object target)
+{
+	if (!target || target->GetObjectLayer() != blast.Layer) return 0;
+
+	var left = target->GetX() + target->GetDefOffset(0);
+	var top = target->GetY() + target->GetDefOffset(1);
+	var at_center = left < blast.X + 5 && left + target->GetDefWidth() > blast.X - 5
+	             && top < blast.Y + 5 && top + target->GetDefHeight() > blast.Y - 5;
+	var distance = Distance(blast.X, blast.Y, target->GetX(), target->GetY());
+
+	var damage = 0;
+	for (var stage in blast.Stages)
+	{
+		if (at_center)
+		{
+			damage += stage[1];
+		}
+		else if (distance <= stage[0])
+		{
+			damage += stage[1] / 2;
+		}
+	}
+	return damage;
 }
 
 //------------------------------------------------------------------------------------------------------------
@@ -67,6 +360,7 @@ global func Explosion(array radius_stages, array damage_stages, bool silent, boo
 global func BlastObjects(int x, int y, int level, object container, int cause_plr, int damage_level, object layer, object prev_container, bool no_shockwave)
 {
 	var obj;
+	ProfileBegin("BlastObjects");
 
 	// Coordinates are always supplied globally, convert to local coordinates.
 	var l_x = x - GetX(), l_y = y - GetY();
@@ -87,7 +381,10 @@ global func BlastObjects(int x, int y, int level, object container, int cause_pl
 		{
 			container->BlastObject(damage_level, cause_plr);
 			if (!container)
+			{
+				ProfileEnd("BlastObjects");
 				return true; // Container could be removed in the meanwhile.
+			}
 			for (obj in FindObjects(Find_Container(container), Find_Layer(layer), Find_Exclude(prev_container)))
 				if (obj)
 					obj->BlastObject(damage_level, cause_plr);
@@ -123,5 +420,6 @@ global func BlastObjects(int x, int y, int level, object container, int cause_pl
 		}
 	}
 	// Done.
+	ProfileEnd("BlastObjects");
 	return true;
 }
@@ -8,6 +8,8 @@
 /**
 	Heals the object over time for /amount/ HP.
 	Calling the function multiple times results in faster healing (as opposed to longer healing).
+	All calls are merged into one effect, that changes the energy at most once per frame.
+	The effect timer runs only as often as the intervals of the healing require.
 
 	If necessary, a custom interval can be set. The healing effect restores 1 energy per interval.
 
@@ -29,12 +31,13 @@ global func Heal(int amount, int interval, bool no_stacking, bool cancel_on_dama
 	}
 	else
 	{
-		// Add effect.
-		var fx = CreateEffect(FxHealingOverTimeCmc, 1, interval ?? 36);
-		fx.healing_amount = amount;
-		fx.done = 0;
-		fx.cancel_on_damage = cancel_on_damage;
-		fx.timer_callback = timer_callback;
+		// All healing is accumulated in one effect, so that the energy changes only once per frame
+		interval = interval ?? 36;
+		var fx = GetEffect(FxHealingOverTimeCmc.Name, this) ?? CreateEffect(FxHealingOverTimeCmc, 1, interval);
+		if (fx)
+		{
+			fx->AddHealing(amount, interval, cancel_on_damage, timer_callback);
+		}
 		return fx;
 	}
 }
@@ -42,19 +45,116 @@ global func Heal(int amount, int interval, bool no_stacking, bool cancel_on_dama
 
 static const FxHealingOverTimeCmc = new Effect
 {
+	Name = "FxHealingOverTimeCmc",
+
+	Start = func (int temporary)
+	{
+		if (!temporary)
+		{
+			this.healing = [];
+		}
+		return FX_OK;
+	},
+
+	// Adds a healing source, every source heals 1 energy per interval
+	AddHealing = func (int amount, int interval, bool cancel_on_damage, array timer_callback)
+	{
+		interval = Max(1, interval);
+
+		// The source starts on a frame where the timer runs, so that it is due on such frames only
+		var step = GreatestCommonDivisor(this.Interval, interval);
+		var start = (this.Time + step - 1) / step * step;
+
+		PushBack(this.healing, {
+			healing_amount = amount,
+			done = 0,
+			interval = interval,
+			start = start,
+			cancel_on_damage = cancel_on_damage,
+			timer_callback = timer_callback,
+		});
+		UpdateInterval();
+	},
+
+	// The timer runs on every frame where a source can be due: A source is due
+	// on its start plus multiples of its interval, so the timer interval is
+	// the greatest common divisor of all starts and intervals.
+	UpdateInterval = func ()
+	{
+		var interval = 0;
+		for (var source in this.healing)
+		{
+			interval = GreatestCommonDivisor(interval, source.interval);
+			interval = GreatestCommonDivisor(interval, source.start);
+		}
+		if (interval > 0)
+		{
+			this.Interval = interval;
+		}
+	},
+
+	GreatestCommonDivisor = func (int a, int b)
+	{
+		while (b != 0)
+		{
+			var rest = a % b;
+			a = b;
+			b = rest;
+		}
+		return a;
+	},
+
 	Timer = func (int time)
 	{
-		// Stop healing the Clonk if he reached full health. Additionally, if the object is dead (fake death).
-		if (Target->GetEnergy() >= Target->GetMaxEnergy() || this.done >= this.healing_amount || !(Target->GetAlive()))
+		// Stop healing the Clonk if he is dead (fake death).
+		if (!(Target->GetAlive()))
 		{
 			return FX_Execute_Kill;
 		}
-		Target->DoEnergy(1);
-		++this.done;
 
-		if (this.timer_callback)
+		// Collect the healing of all sources that are due this frame
+		var missing = Target->GetMaxEnergy() - Target->GetEnergy();
+		var energy = 0;
+		var callbacks = [];
+		for (var i = 0; i < GetLength(this.healing); ++i)
+		{
+			var source = this.healing[i];
+			var source_time = time - source.start;
+			if (source_time <= 0 || source_time % source.interval != 0)
+			{
+				continue;
+			}
+
+			// Stop healing if he reached full health.
+			if (energy >= missing || source.done >= source.healing_amount)
+			{
+				this.healing[i] = nil;
+				continue;
+			}
+			++energy;
+			++source.done;
+
+			if (source.timer_callback)
+			{
+				PushBack(callbacks, [source.timer_callback, source_time]);
+			}
+		}
+		RemoveHoles(this.healing);
+		UpdateInterval();
+
+		// Only one energy change, so that the HUD is notified only once
+		if (energy > 0)
+		{
+			Target->DoEnergy(energy);
+		}
+		for (var callback in callbacks)
 		{
-			DoCallback(this.timer_callback, Target, time);
+			InvokeCallback(callback[0], Target, callback[1]);
+		}
+
+		if (GetLength(this.healing) == 0)
+		{
+			return FX_Execute_Kill;
 		}
 		return FX_OK;
 	},
@@ -62,9 +162,24 @@ static const FxHealingOverTimeCmc = new Effect
 	Damage = func (int damage, int cause, int by_player)
 	{
 		// Stop healing, if the Clonk receives damage?
-		if (this.cancel_on_damage && damage < 0)
+		if (damage < 0)
 		{
-			RemoveEffect(nil, Target, this);
+			for (var i = 0; i < GetLength(this.healing); ++i)
+			{
+				if (this.healing[i].cancel_on_damage)
+				{
+					this.healing[i] = nil;
+				}
+			}
+			RemoveHoles(this.healing);
+			if (GetLength(this.healing) == 0)
+			{
+				RemoveEffect(nil, Target, this);
+			}
+			else
+			{
+				UpdateInterval();
+			}
 		}
 		return damage;
 	},
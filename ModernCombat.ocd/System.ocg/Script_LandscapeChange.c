@@ -0,0 +1,110 @@
+/**
+	Landscape changes
+
+	Reports the area of every landscape change that a script makes to
+	OnLandscapeChanged(), so that information about the landscape, such as
+	the visibility grid and the round snapshot, can be updated there.
+
+	@note The engine also changes the landscape on its own, for example
+	      when material falls or flows. These changes are not reported.
+ */
+
+/* --- Interface --- */
+
+/**
+	Called after the landscape was changed by a script.
+
+	@par x The left edge, in global coordinates.
+	@par y The top edge, in global coordinates.
+ */
+global func OnLandscapeChanged(int x, int y, int wdt, int hgt)
+{
+	UpdateVisibilityGrid(x, y, wdt, hgt);
+	MarkRoundSnapshotChanged(x, y, wdt, hgt);
+}
+
+/* --- Landscape changes --- */
+
+// Coordinates are relative to the calling object
+global func BlastFree(int x, int y, int radius, caused_by, max_density)
+{
+	var result = _inherited(x, y, radius, caused_by, max_density, ...);
+	if (GetType(this) == C4V_C4Object)
+	{
+		x += GetX();
+		y += GetY();
+	}
+	OnLandscapeChanged(x - radius, y - radius, 2 * radius, 2 * radius);
+	return result;
+}
+
+
+// Coordinates are relative to the calling object
+global func DigFree(int x, int y, int radius, bool no_dig2objects, bool no_instability_check)
+{
+	var result = _inherited(x, y, radius, no_dig2objects, no_instability_check, ...);
+	if (GetType(this) == C4V_C4Object)
+	{
+		x += GetX();
+		y += GetY();
+	}
+	OnLandscapeChanged(x - radius, y - radius, 2 * radius, 2 * radius);
+	return result;
+}
+
+
+global func DigFreeRect(int x, int y, int wdt, int hgt, bool no_dig2objects, bool no_instability_check)
+{
+	var result = _inherited(x, y, wdt, hgt, no_dig2objects, no_instability_check, ...);
+	OnLandscapeChanged(x, y, wdt, hgt);
+	return result;
+}
+
+
+global func ClearFreeRect(int x, int y, int wdt, int hgt)
+{
+	var result = _inherited(x, y, wdt, hgt, ...);
+	OnLandscapeChanged(x, y, wdt, hgt);
+	return result;
+}
+
+
+global func ShakeFree(int x, int y, int radius)
+{
+	var result = _inherited(x, y, radius, ...);
+	if (GetType(this) == C4V_C4Object)
+	{
+		x += GetX();
+		y += GetY();
+	}
+	OnLandscapeChanged(x - radius, y - radius, 2 * radius, 2 * radius);
+	return result;
+}
+
+
+global func DrawMaterialQuad(string material, int x1, int y1, int x2, int y2, int x3, int y3, int x4, int y4, sub)
+{
+	var result = _inherited(material, x1, y1, x2, y2, x3, y3, x4, y4, sub, ...);
+	var left = Min(Min(x1, x2), Min(x3, x4));
+	var top = Min(Min(y1, y2), Min(y3, y4));
+	var right = Max(Max(x1, x2), Max(x3, x4));
+	var bottom = Max(Max(y1, y2), Max(y3, y4));
+	OnLandscapeChanged(left, top, right - left, bottom - top);
+	return result;
+}
+
+
+global func DrawMap(int x, int y, int wdt, int hgt, string map_def)
+{
+	var result = _inherited(x, y, wdt, hgt, map_def, ...);
+	OnLandscapeChanged(x, y, wdt, hgt);
+	return result;
+}
+
+
+global func DrawDefMap(int x, int y, int wdt, int hgt, string map_name)
+{
+	var result = _inherited(x, y, wdt, hgt, map_name, ...);
+	OnLandscapeChanged(x, y, wdt, hgt);
+	return result;
+}
@@ -112,3 +112,42 @@ global func RGBaDoLightness(int rgba, int change)
 	return RGBa(color.R, color.G, color.B, alpha);
 }
 
+
+
+/**
+	Gets where a line enters a rectangle.
+
+	@return int The position on the line, from 0 (start) to 1000 (end);
+	            {@code nil} if the line does not touch the rectangle.
+ */
+global func GetLineRectEntry(int x1, int y1, int x2, int y2, int left, int top, int right, int bottom)
+{
+	var dx = x2 - x1;
+	var dy = y2 - y1;
+	var entry = 0;
+	var exit = 1000;
+	// Clip the line at every edge, see Liang-Barsky
+	for (var edge in [[-dx, x1 - left], [dx, right - x1], [-dy, y1 - top], [dy, bottom - y1]])
+	{
+		var direction = edge[0];
+		var distance = edge[1];
+		if (direction == 0)
+		{
+			if (distance < 0) return nil;
+		}
+		else
+		{
+			var position = 1000 * distance / direction;
+			if (direction < 0)
+			{
+				entry = Max(entry, position);
+			}
+			else
+			{
+				exit = Min(exit, position);
+			}
+			if (entry > exit) return nil;
+		}
+	}
+	return entry;
+}
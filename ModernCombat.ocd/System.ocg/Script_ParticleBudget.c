@@ -0,0 +1,188 @@
+/**
+	Particle budget
+
+	Effects request their particle amount before calling CreateParticle().
+	The amount is scaled down when too many particles are created in the
+	same frame, or when the position is far away from all players.
+
+	Only synchronized values are used for the decision, so the result is
+	the same on all clients, even if the effect uses Random() for every
+	particle.
+
+	@note Use it like this:
+	{@code
+		var amount = RequestParticles("Dust", 5, PARTICLE_Priority_Normal);
+		if (amount > 0)
+		{
+			CreateParticle("Dust", 0, 0, ..., amount);
+		}
+	}
+ */
+
+/* --- Constants --- */
+
+static const PARTICLE_Priority_Low = 0;    // Decoration that is dropped first, e.g. smoke trails
+static const PARTICLE_Priority_Normal = 1; // Default priority, e.g. hit effects
+static const PARTICLE_Priority_High = 2;   // Always created, e.g. blood splatter that stays visible for a long time
+
+static const PARTICLE_FrameBudget = 400;   // Particles per frame before the amounts are reduced
+static const PARTICLE_ViewRangeFactor = 2; // Positions further away than this many view ranges from all players get no particles
+
+static particle_budget; // Usage of the current frame and counters, see GetParticleBudget()
+
+/* --- Interface --- */
+
+/**
+	Gets the amount of particles that an effect should create.
+
+	@par category Name of the effect, for the counters.
+	@par amount The amount that the effect wants to create.
+	@par priority See PARTICLE_Priority_*, the default is PARTICLE_Priority_Normal.
+	@par x The X position, relative to the calling object.
+	@par y The Y position, relative to the calling object.
+
+	@return int The amount that the effect should create; May be 0.
+ */
+global func RequestParticles(string category, int amount, int priority, int x, int y)
+{
+	var budget = GetParticleBudget();
+	priority = priority ?? PARTICLE_Priority_Normal;
+	if (GetType(this) == C4V_C4Object)
+	{
+		x += GetX();
+		y += GetY();
+	}
+
+	var granted = amount;
+	if (priority < PARTICLE_Priority_High)
+	{
+		granted = amount * GetParticleDistanceFactor(budget, x, y) / 100;
+		granted = granted * GetParticleLoadFactor(budget, priority) / 100;
+	}
+
+	budget.used += granted;
+	var counter = budget.counters[category];
+	if (!counter)
+	{
+		counter = {requested = 0, emitted = 0};
+		budget.counters[category] = counter;
+	}
+	counter.requested += amount;
+	counter.emitted += granted;
+	return granted;
+}
+
+
+/**
+	Gets the counters of a category: {requested, emitted}
+
+	@par category The category, or {@code nil} for the sum of all categories.
+ */
+global func GetParticleCounters(string category)
+{
+	var counters = GetParticleBudget().counters;
+	var sum = {requested = 0, emitted = 0};
+	for (var name in GetProperties(counters))
+	{
+		if (category == nil || category == name)
+		{
+			sum.requested += counters[name].requested;
+			sum.emitted += counters[name].emitted;
+		}
+	}
+	return sum;
+}
+
+
+/**
+	Logs the emitted and requested particles of every category.
+ */
+global func LogParticleCounters()
+{
+	var counters = GetParticleBudget().counters;
+	for (var category in GetProperties(counters))
+	{
+		var counter = counters[category];
+		Log("[Particles] %s;emitted=%d;requested=%d", category, counter.emitted, counter.requested);
+	}
+}
+
+
+/**
+	Sets the counters of all categories to zero.
+ */
+global func ResetParticleCounters()
+{
+	GetParticleBudget().counters = {};
+}
+
+/* --- Internals --- */
+
+global func GetParticleBudget()
+{
+	if (!particle_budget)
+	{
+		particle_budget = {frame = nil, used = 0, views = [], counters = {}};
+	}
+	// Usage and views are determined once per frame
+	if (particle_budget.frame != FrameCounter())
+	{
+		particle_budget.frame = FrameCounter();
+		particle_budget.used = 0;
+		particle_budget.views = [];
+		for (var i = 0; i < GetPlayerCount(C4PT_User); ++i)
+		{
+			var cursor = GetCursor(GetPlayerByIndex(i, C4PT_User));
+			if (cursor)
+			{
+				PushBack(particle_budget.views, {X = cursor->GetX(), Y = cursor->GetY()});
+			}
+		}
+	}
+	return particle_budget;
+}
+
+
+// Percentage of the amount, depending on the distance to the nearest player view; 0 if there are no user players at all
+global func GetParticleDistanceFactor(proplist budget, int x, int y)
+{
+	var range = CMC_ViewRange_Default_Player;
+	var nearest;
+	for (var view in budget.views)
+	{
+		var distance = Max(Abs(view.X - x), Abs(view.Y - y));
+		if (nearest == nil || distance < nearest)
+		{
+			nearest = distance;
+		}
+	}
+	if (nearest == nil || nearest > PARTICLE_ViewRangeFactor * range)
+	{
+		return 0;
+	}
+	if (nearest <= range)
+	{
+		return 100;
+	}
+	return 50;
+}
+
+
+// Percentage of the amount, depending on how many particles were created in this frame already
+global func GetParticleLoadFactor(proplist budget, int priority)
+{
+	var load = 100 * budget.used / PARTICLE_FrameBudget;
+	if (load >= 100)
+	{
+		if (priority == PARTICLE_Priority_Low)
+		{
+			return 0;
+		}
+		return 25;
+	}
+	if (load >= 50 && priority == PARTICLE_Priority_Low)
+	{
+		return 50;
+	}
+	return 100;
+}
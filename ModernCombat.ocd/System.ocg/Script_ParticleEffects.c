@@ -24,3 +24,98 @@ global func Particles_ThrustColored(int r, int g, int b)
 		B = PV_KeyFrames(0, 0, b, 500, 2 * b / 5, 1000, b / 5),		
 	};
 }
+
+/* --- Particle definition cache --- */
+
+static const PARTICLE_DefinitionCacheMax = 500; // The cache is cleared if it grows beyond this many definitions
+
+static particle_definitions; // Cached definitions and counters, see GetParticleDefinitionCache()
+
+/**
+	Gets a particle definition from the cache.
+	Definitions are identified by a key that contains everything
+	that the definition depends on, e.g. Format("BulletDust:%d:%d", color, size).
+	Variation per particle has to come from PV_Random() in the definition.
+
+	@par key The key of the definition.
+
+	@return proplist The definition, or {@code nil} if it was not stored yet.
+	                 The definition must not be modified.
+ */
+global func GetParticleDefinition(string key)
+{
+	var cache = GetParticleDefinitionCache();
+	if (cache.disabled)
+	{
+		return nil;
+	}
+	var definition = cache.definitions[key];
+	if (definition)
+	{
+		cache.counters.reused += 1;
+	}
+	return definition;
+}
+
+
+/**
+	Stores a particle definition in the cache.
+	Use it together with GetParticleDefinition():
+	{@code
+		var particles = GetParticleDefinition(key) ?? StoreParticleDefinition(key, {...});
+	}
+
+	@par key The key of the definition.
+	@par definition The definition.
+
+	@return proplist The definition.
+ */
+global func StoreParticleDefinition(string key, proplist definition)
+{
+	var cache = GetParticleDefinitionCache();
+	cache.counters.built += 1;
+	if (!cache.disabled)
+	{
+		if (cache.count >= PARTICLE_DefinitionCacheMax)
+		{
+			cache.definitions = {};
+			cache.count = 0;
+		}
+		cache.definitions[key] = definition;
+		cache.count += 1;
+	}
+	return definition;
+}
+
+
+/**
+	Enables or disables the particle definition cache.
+	Every definition is built again while it is disabled.
+ */
+global func SetParticleDefinitionCache(bool enabled)
+{
+	var cache = GetParticleDefinitionCache();
+	cache.disabled = !enabled;
+	cache.definitions = {};
+	cache.count = 0;
+}
+
+
+/**
+	Gets how many particle definitions were built and reused: {built, reused}
+ */
+global func GetParticleDefinitionCounters()
+{
+	var counters = GetParticleDefinitionCache().counters;
+	return {built = counters.built, reused = counters.reused};
+}
+
+
+global func GetParticleDefinitionCache()
+{
+	if (!particle_definitions)
+	{
+		particle_definitions = {definitions = {}, count = 0, disabled = false, counters = {built = 0, reused = 0}};
+	}
+	return particle_definitions;
+}
@@ -0,0 +1,162 @@
+/**
+	CMC profiler
+
+	Measures how often and how long script functions run.
+
+	The profiler is disabled by default. All functions return right away
+	then, so the calls can stay in the code. It is enabled by
+	CMC_Game_Session_Configurator->UseScriptProfiler(), or by calling
+	EnableProfiler(true).
+
+	@note Use it like this:
+	{@code
+		ProfileBegin("Bullet::OnHitLandscape");
+		... // Do stuff
+		ProfileCount("Bullet::Particles", amount);
+		ProfileEnd("Bullet::OnHitLandscape");
+	}
+
+	The values are aggregated per name:
+	- calls: Number of ProfileBegin() calls
+	- ops: Sum of the amounts from ProfileCount()
+	- frames: Number of frames with at least one call or count
+	- max_per_frame: Most calls and ops in a single frame
+	- time_ms: Real time between ProfileBegin() and ProfileEnd()
+
+	The table is logged at the end of the round and with the
+	message board command /profile.
+ */
+
+static cmc_profiler; // Entries by name, nil if the profiler is disabled
+
+/* --- Interface --- */
+
+/**
+	Enables or disables the profiler.
+	Disabling the profiler discards all values.
+ */
+global func EnableProfiler(bool enable)
+{
+	if (enable)
+	{
+		cmc_profiler = cmc_profiler ?? {};
+	}
+	else
+	{
+		cmc_profiler = nil;
+	}
+}
+
+
+global func IsProfilerEnabled()
+{
+	return cmc_profiler != nil;
+}
+
+
+/**
+	Starts measuring a scope.
+	Scopes with the same name can be nested, e.g. in recursive calls;
+	Only the outermost scope is timed then, so that no time is counted twice.
+
+	@par name The name of the scope.
+ */
+global func ProfileBegin(string name)
+{
+	if (!cmc_profiler) return;
+
+	var entry = GetProfilerEntry(name, 1);
+	entry.calls += 1;
+	if (entry.depth == 0)
+	{
+		entry.start = GetTime();
+	}
+	entry.depth += 1;
+}
+
+
+/**
+	Stops measuring a scope.
+
+	@par name The name of the scope, the same as in ProfileBegin().
+ */
+global func ProfileEnd(string name)
+{
+	if (!cmc_profiler) return;
+
+	var entry = cmc_profiler[name];
+	if (entry && entry.depth > 0)
+	{
+		entry.depth -= 1;
+		if (entry.depth == 0)
+		{
+			entry.time += GetTime() - entry.start;
+			entry.start = nil;
+		}
+	}
+}
+
+
+/**
+	Counts operations, such as the number of objects that were searched.
+
+	@par name The name of the counter.
+	@par amount The number of operations, 1 by default.
+ */
+global func ProfileCount(string name, int amount)
+{
+	if (!cmc_profiler) return;
+
+	amount = amount ?? 1;
+	var entry = GetProfilerEntry(name, amount);
+	entry.ops += amount;
+}
+
+
+/**
+	Logs the aggregated values of all scopes and counters.
+
+	@par reset Discards the values afterwards.
+ */
+global func ProfileDump(bool reset)
+{
+	if (!cmc_profiler)
+	{
+		Log("[Profiler] disabled");
+		return;
+	}
+
+	Log("[Profiler] frame=%d", FrameCounter());
+	for (var name in GetProperties(cmc_profiler))
+	{
+		var entry = cmc_profiler[name];
+		Log("[Profiler] %s;calls=%d;frames=%d;ops=%d;max_per_frame=%d;time_ms=%d", name, entry.calls, entry.frames, entry.ops, entry.max_per_frame, entry.time);
+	}
+	if (reset)
+	{
+		cmc_profiler = {};
+	}
+}
+
+/* --- Internals --- */
+
+global func GetProfilerEntry(string name, int frame_amount)
+{
+	var entry = cmc_profiler[name];
+	if (!entry)
+	{
+		entry = {calls = 0, ops = 0, frames = 0, max_per_frame = 0, time = 0, depth = 0, frame = nil, frame_amount = 0};
+		cmc_profiler[name] = entry;
+	}
+
+	// Count per frame
+	if (entry.frame != FrameCounter())
+	{
+		entry.frame = FrameCounter();
+		entry.frame_amount = 0;
+		entry.frames += 1;
+	}
+	entry.frame_amount += frame_amount;
+	entry.max_per_frame = Max(entry.max_per_frame, entry.frame_amount);
+	return entry;
+}
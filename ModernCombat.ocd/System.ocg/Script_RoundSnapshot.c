@@ -0,0 +1,268 @@
+/**
+	Round snapshot
+
+	Records what a scenario creates in CreateInterior() in the first round:
+	the quads that are drawn with DrawMaterialQuad(), and the objects. Later
+	round resets restore only the quads whose landscape changed, and create
+	only the objects that were removed or moved from where they settled.
+
+	Only quads in areas that were changed by a script since the last reset
+	are compared, see OnLandscapeChanged(). Changes that the engine makes
+	on its own, such as falling material, are not detected.
+
+	The scenario enables this with UseRoundSnapshot(). It is suited for
+	scenarios that draw ramps and place static objects; Objects are recreated
+	with their ID, position, rotation and owner only. Objects that are
+	configured after creation, such as spawn points, belong in CreateEquipment():
+	The equipment is created by the scenario in every round, and the equipment
+	of the previous round is removed when the snapshot is restored.
+ */
+
+static const SNAPSHOT_SampleStep = 2; // Landscape is compared every this many pixels
+
+static round_snapshot; // The snapshot, see BeginRoundSnapshot()
+
+/* --- Interface --- */
+
+// Starts recording the quads and objects.
+global func BeginRoundSnapshot()
+{
+	round_snapshot = {Recording = true, Quads = [], Objects = [], Equipment = [], Changes = []};
+	round_snapshot.ObjectStart = GetRoundSnapshotLastObject();
+	return round_snapshot;
+}
+
+
+// Stops recording, the landscape of the quads is captured.
+global func FinishRoundSnapshot()
+{
+	if (!round_snapshot) return;
+
+	round_snapshot.Recording = false;
+	for (var quad in round_snapshot.Quads)
+	{
+		quad.Materials = GetRoundSnapshotMaterials(quad);
+	}
+	// Objects that were removed while recording, such as templates, are gone already.
+	// Contained and attached objects belong to other objects, which create them again.
+	for (var obj in FindObjects(Find_AnyLayer()))
+	{
+		if (obj->ObjectNumber() > round_snapshot.ObjectStart && !obj->Contained() && obj->GetProcedure() != "ATTACH")
+		{
+			RecordRoundSnapshotObject(obj);
+		}
+	}
+	round_snapshot.ObjectStart = nil;
+	round_snapshot.Changes = [];
+}
+
+
+global func HasRoundSnapshot()
+{
+	return round_snapshot != nil && !round_snapshot.Recording;
+}
+
+
+/**
+	Restores the quads whose landscape changed, and the objects
+	that are gone or were moved. Removes the equipment of the
+	previous round.
+
+	@return proplist The number of restored things: {quads, objects}.
+ */
+global func RestoreRoundSnapshot()
+{
+	var restored = {quads = 0, objects = 0};
+	if (!HasRoundSnapshot()) return restored;
+
+	for (var obj in round_snapshot.Equipment)
+	{
+		if (obj && !obj->Contained())
+		{
+			obj->RemoveObject();
+		}
+	}
+	round_snapshot.Equipment = [];
+
+	for (var quad in round_snapshot.Quads)
+	{
+		if (IsRoundSnapshotQuadChanged(quad) && !IsRoundSnapshotQuadIntact(quad))
+		{
+			DrawMaterialQuad(quad.Material, quad.X1, quad.Y1, quad.X2, quad.Y2, quad.X3, quad.Y3, quad.X4, quad.Y4, quad.Sub);
+			restored.quads += 1;
+		}
+	}
+	round_snapshot.Changes = []; // Also discards the areas of the quads that were just drawn
+	for (var entry in round_snapshot.Objects)
+	{
+		var obj = entry.Object;
+		if (obj && !obj->Contained() && obj->GetX() == (entry.SettledX ?? entry.X) && obj->GetY() == (entry.SettledY ?? entry.Y))
+		{
+			continue;
+		}
+		if (obj)
+		{
+			obj->RemoveObject();
+		}
+		entry.Object = CreateObject(entry.ID, entry.X, entry.Y, entry.Owner);
+		if (entry.Object)
+		{
+			entry.Object->SetR(entry.R);
+		}
+		entry.SettledX = nil;
+		entry.SettledY = nil;
+		restored.objects += 1;
+	}
+	return restored;
+}
+
+
+/**
+	Captures where the objects came to rest, for the comparison
+	in the next round reset. Objects that fell after creation are
+	not recreated because of that. Call this once the objects had
+	some frames to settle, e.g. at the start of the round.
+ */
+global func SettleRoundSnapshot()
+{
+	if (!HasRoundSnapshot()) return;
+
+	for (var entry in round_snapshot.Objects)
+	{
+		if (entry.Object && entry.SettledX == nil)
+		{
+			entry.SettledX = entry.Object->GetX();
+			entry.SettledY = entry.Object->GetY();
+		}
+	}
+}
+
+
+// Starts recording the equipment, so that it can be removed in the next round reset.
+global func BeginRoundSnapshotEquipment()
+{
+	if (!HasRoundSnapshot()) return;
+
+	round_snapshot.EquipmentStart = GetRoundSnapshotLastObject();
+}
+
+
+// Stops recording the equipment.
+global func FinishRoundSnapshotEquipment()
+{
+	if (!HasRoundSnapshot() || round_snapshot.EquipmentStart == nil) return;
+
+	for (var obj in FindObjects(Find_AnyLayer()))
+	{
+		if (obj->ObjectNumber() > round_snapshot.EquipmentStart && !obj->Contained())
+		{
+			PushBack(round_snapshot.Equipment, obj);
+		}
+	}
+	round_snapshot.EquipmentStart = nil;
+}
+
+/**
+	Remembers an area where the landscape changed, so that the quads
+	there are compared in the next round reset.
+
+	@par x The left edge, in global coordinates.
+	@par y The top edge, in global coordinates.
+ */
+global func MarkRoundSnapshotChanged(int x, int y, int wdt, int hgt)
+{
+	if (!HasRoundSnapshot()) return;
+
+	PushBack(round_snapshot.Changes, {Left = x, Top = y, Right = x + wdt, Bottom = y + hgt});
+}
+
+/* --- Recording --- */
+
+global func DrawMaterialQuad(string material, int x1, int y1, int x2, int y2, int x3, int y3, int x4, int y4, sub)
+{
+	if (round_snapshot && round_snapshot.Recording)
+	{
+		PushBack(round_snapshot.Quads,
+		{
+			Material = material,
+			X1 = x1, Y1 = y1, X2 = x2, Y2 = y2, X3 = x3, Y3 = y3, X4 = x4, Y4 = y4,
+			Sub = sub,
+		});
+	}
+	return _inherited(material, x1, y1, x2, y2, x3, y3, x4, y4, sub, ...);
+}
+
+/* --- Internals --- */
+
+global func RecordRoundSnapshotObject(object obj)
+{
+	PushBack(round_snapshot.Objects,
+	{
+		Object = obj,
+		ID = obj->GetID(),
+		X = obj->GetX(),
+		Y = obj->GetY(),
+		R = obj->GetR(),
+		Owner = obj->GetOwner(),
+	});
+}
+
+
+global func GetRoundSnapshotLastObject()
+{
+	var last_object = 0;
+	for (var obj in FindObjects(Find_AnyLayer()))
+	{
+		last_object = Max(last_object, obj->ObjectNumber());
+	}
+	return last_object;
+}
+
+
+global func IsRoundSnapshotQuadChanged(proplist quad)
+{
+	var left = Min(Min(quad.X1, quad.X2), Min(quad.X3, quad.X4));
+	var right = Max(Max(quad.X1, quad.X2), Max(quad.X3, quad.X4));
+	var top = Min(Min(quad.Y1, quad.Y2), Min(quad.Y3, quad.Y4));
+	var bottom = Max(Max(quad.Y1, quad.Y2), Max(quad.Y3, quad.Y4));
+	for (var change in round_snapshot.Changes)
+	{
+		if (change.Left <= right && change.Right >= left && change.Top <= bottom && change.Bottom >= top)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+
+global func GetRoundSnapshotMaterials(proplist quad)
+{
+	var materials = [];
+	var left = Min(Min(quad.X1, quad.X2), Min(quad.X3, quad.X4));
+	var right = Max(Max(quad.X1, quad.X2), Max(quad.X3, quad.X4));
+	var top = Min(Min(quad.Y1, quad.Y2), Min(quad.Y3, quad.Y4));
+	var bottom = Max(Max(quad.Y1, quad.Y2), Max(quad.Y3, quad.Y4));
+	for (var x = left; x <= right; x += SNAPSHOT_SampleStep)
+	{
+		for (var y = top; y <= bottom; y += SNAPSHOT_SampleStep)
+		{
+			PushBack(materials, GetMaterial(x, y));
+		}
+	}
+	return materials;
+}
+
+
+global func IsRoundSnapshotQuadIntact(proplist quad)
+{
+	var materials = GetRoundSnapshotMaterials(quad);
+	for (var i = 0; i < GetLength(materials); ++i)
+	{
+		if (materials[i] != quad.Materials[i])
+		{
+			return false;
+		}
+	}
+	return true;
+}
@@ -5,6 +5,20 @@
 */
 
 
+static const SOUND_Priority_Low = 0;    // May be dropped early, e.g. fire sounds of automatic weapons
+static const SOUND_Priority_Normal = 1; // Default priority
+static const SOUND_Priority_High = 2;   // Never dropped, e.g. hit sounds
+
+static const SOUND_MergeDistance = 20;  // Identical sounds closer than this in the same frame are played once
+static const SOUND_VoiceLimit_Low = 8;  // Low priority sounds are played only if there are fewer sounds in this frame
+static const SOUND_VoiceLimit_Normal = 16;
+static const SOUND_EmitterHold = 70;    // Emitters stay at their position for this many frames, so that the sound can finish
+static const SOUND_EmitterMax = 40;
+static const SOUND_EmitterShare_Low = 10; // Other sounds leave this many emitters to low priority sounds
+
+static sound_pool; // Emitters, voices of the current frame and counters, see GetSoundPool()
+
+
 /*
  Modification to Sound():
  a) Playing one sound for a specific player and a different sound for other players:
@@ -17,20 +31,17 @@
  - Note that "others" = nil is redundant, you could simply call Sound("foo", {player = some_index})
  b) Playing one sound before it was faded out:
  - Pass a proplist with the property "multiple = true".
+ - The sound is played by a pooled emitter object at the position of the calling object.
+ - Identical sounds that are requested at nearby positions in the same frame are played only once.
+ - The property "priority" decides which sounds are dropped if too many sounds are requested
+   in the same frame, see SOUND_Priority_*. Sounds with high priority are never dropped.
  */
 global func Sound(name, opts, ...)
 {
 	// Support multiple sounds; FIXME - should be backported to OC
 	if (GetType(opts) == C4V_PropList && opts.multiple)
 	{
-		var source = CreateObject(Dummy, 0, 0, NO_OWNER);
-		source.Visibility = VIS_All;
-		opts.multiple = false;
-		var result = source->Sound(name, opts);
-		// Note: Removing the object in the same frame plays the sound at 100% volume regardless of the volume setting
-		// Note: Scheduling removal of the object will play the sound only once at the same time again :(
-		source->RemoveObject(); 
-		return result;
+		return PlayPooledSound(name, opts);
 	}
 
 	if (GetType(name) == C4V_PropList)
@@ -73,3 +84,150 @@ global func Sound(name, opts, ...)
 		return inherited(name, opts, ...);
 	}
 }
+
+
+/* --- Sound emitter pool --- */
+
+// Plays a sound with a pooled emitter, at the position of the calling object
+global func PlayPooledSound(name, proplist opts)
+{
+	var pool = GetSoundPool();
+	pool.counters.requested += 1;
+
+	var x = 0, y = 0;
+	if (GetType(this) == C4V_C4Object)
+	{
+		x = GetX();
+		y = GetY();
+	}
+
+	// Merge with an identical sound nearby
+	for (var voice in pool.voices)
+	{
+		if (voice.name == name && Distance(x, y, voice.x, voice.y) <= SOUND_MergeDistance)
+		{
+			pool.counters.merged += 1;
+			return true;
+		}
+	}
+
+	// Limit the number of sounds per frame
+	var priority = opts.priority ?? SOUND_Priority_Normal;
+	var voices = GetLength(pool.voices);
+	if ((priority == SOUND_Priority_Low && voices >= SOUND_VoiceLimit_Low)
+	 || (priority == SOUND_Priority_Normal && voices >= SOUND_VoiceLimit_Normal))
+	{
+		pool.counters.dropped += 1;
+		return false;
+	}
+
+	var emitter = GetSoundEmitter(pool, x, y, priority);
+	if (!emitter)
+	{
+		pool.counters.dropped += 1;
+		return false;
+	}
+	PushBack(pool.voices, {name = name, x = x, y = y});
+	pool.counters.played += 1;
+	return emitter->Sound(name, {Prototype = opts, multiple = false});
+}
+
+
+// Gets a free emitter at the position; If all emitters are playing, the one that finishes first is taken.
+// Low priority sounds have a share of the emitters that other sounds do not take, and take
+// only emitters that play low priority sounds, so that neither starves the other.
+global func GetSoundEmitter(proplist pool, int x, int y, int priority)
+{
+	var free, oldest_low, oldest_other;
+	var playing_other = 0;
+	for (var candidate in pool.emitters)
+	{
+		if (!candidate) continue;
+
+		if (candidate->IsSoundEmitterFree())
+		{
+			free = free ?? candidate;
+		}
+		else if (candidate->GetSoundEmitterPriority() == SOUND_Priority_Low)
+		{
+			if (!oldest_low || candidate->GetSoundEmitterFreeFrame() < oldest_low->GetSoundEmitterFreeFrame())
+			{
+				oldest_low = candidate;
+			}
+		}
+		else
+		{
+			playing_other += 1;
+			if (!oldest_other || candidate->GetSoundEmitterFreeFrame() < oldest_other->GetSoundEmitterFreeFrame())
+			{
+				oldest_other = candidate;
+			}
+		}
+	}
+
+	var emitter;
+	if (priority > SOUND_Priority_Low && playing_other >= SOUND_EmitterMax - SOUND_EmitterShare_Low)
+	{
+		// The remaining emitters are left to low priority sounds
+		emitter = oldest_other;
+	}
+	else
+	{
+		emitter = free;
+		if (!emitter)
+		{
+			RemoveHoles(pool.emitters);
+			if (GetLength(pool.emitters) < SOUND_EmitterMax)
+			{
+				emitter = CreateObject(CMC_Effect_SoundEmitter, AbsX(x), AbsY(y), NO_OWNER);
+				PushBack(pool.emitters, emitter);
+			}
+			else if (priority > SOUND_Priority_Low)
+			{
+				emitter = oldest_other ?? oldest_low;
+			}
+			else
+			{
+				emitter = oldest_low;
+			}
+		}
+	}
+
+	if (emitter)
+	{
+		emitter->ReserveSoundEmitter(x, y, SOUND_EmitterHold, priority);
+	}
+	return emitter;
+}
+
+
+global func GetSoundPool()
+{
+	if (!sound_pool)
+	{
+		sound_pool = {
+			emitters = [],
+			voices = [],
+			frame = nil,
+			counters = {requested = 0, merged = 0, dropped = 0, played = 0}
+		};
+	}
+	// Voices are counted per frame
+	if (sound_pool.frame != FrameCounter())
+	{
+		sound_pool.frame = FrameCounter();
+		sound_pool.voices = [];
+	}
+	return sound_pool;
+}
+
+
+/*
+ Gets the counters of Sound(..., {multiple = true}):
+ {requested, merged, dropped, played}
+ */
+global func GetSoundCounters()
+{
+	var counters = GetSoundPool().counters;
+	return {requested = counters.requested, merged = counters.merged, dropped = counters.dropped, played = counters.played};
+}
@@ -0,0 +1,101 @@
+/**
+	Visibility profile
+
+	Casts rays from a position at a fixed angular resolution and stores
+	the free distance for every angle. Effects that affect many objects,
+	such as flashes or explosions, can then check whether an object is
+	visible from the position with a lookup, instead of one PathFree()
+	per object.
+
+	@note Use it like this:
+	{@code
+		var profile = GetVisibilityProfile(250);
+		for (var target in FindObjects(Find_Distance(250)))
+		{
+			if (IsVisibleInProfile(profile, target->GetX(), target->GetY()))
+			{
+				... // Do stuff
+			}
+		}
+	}
+ */
+
+static const VISIBILITY_DefaultSteps = 5; // Degrees between two rays
+
+/* --- Interface --- */
+
+/**
+	Gets the visibility profile around the calling object.
+
+	@par range Rays end at this distance.
+	@par steps Degrees between two rays, VISIBILITY_DefaultSteps by default.
+	@par offset_y The rays start at this Y offset from the object.
+
+	@return proplist The profile: {X, Y, Range, Steps, Distances}.
+ */
+global func GetVisibilityProfile(int range, int steps, int offset_y)
+{
+	AssertObjectContext();
+	steps = steps ?? VISIBILITY_DefaultSteps;
+
+	var profile = {X = GetX(), Y = GetY() + offset_y, Range = range, Steps = steps, Distances = []};
+	for (var angle = -180; angle < +180; angle += steps)
+	{
+		var x = profile.X + Sin(angle, range);
+		var y = profile.Y - Cos(angle, range);
+		var blocked = PathFree2(profile.X, profile.Y, x, y);
+		if (blocked)
+		{
+			PushBack(profile.Distances, Distance(profile.X, profile.Y, blocked[0], blocked[1]));
+		}
+		else
+		{
+			PushBack(profile.Distances, range);
+		}
+	}
+	return profile;
+}
+
+
+/**
+	Gets the free distance in the direction of a position.
+
+	@par x The X position, in global coordinates.
+	@par y The Y position, in global coordinates.
+ */
+global func GetVisibilityDistance(proplist profile, int x, int y)
+{
+	var angle = Angle(profile.X, profile.Y, x, y) + 180 + profile.Steps / 2;
+	var index = (angle / profile.Steps) % GetLength(profile.Distances);
+	return profile.Distances[index];
+}
+
+
+/**
+	Checks whether a position can be seen from the origin of the profile.
+
+	@par x The X position, in global coordinates.
+	@par y The Y position, in global coordinates.
+ */
+global func IsVisibleInProfile(proplist profile, int x, int y)
+{
+	return Distance(profile.X, profile.Y, x, y) <= GetVisibilityDistance(profile, x, y);
+}
+
+
+/**
+	Gets the angles with at least the given free distance,
+	like GetPathFreeAngles().
+ */
+global func GetVisibilityProfileAngles(proplist profile, int distance)
+{
+	var angles = [];
+	for (var i = 0; i < GetLength(profile.Distances); ++i)
+	{
+		if (profile.Distances[i] >= distance)
+		{
+			PushBack(angles, -180 + i * profile.Steps);
+		}
+	}
+	return angles;
+}
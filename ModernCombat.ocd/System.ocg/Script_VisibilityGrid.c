@@ -0,0 +1,206 @@
+/**
+	Visibility grid
+
+	Divides the landscape into cells of VISIBILITY_CellSize pixels and stores
+	whether the center of each cell is solid. CoarsePathFree() then walks
+	through the cells on a line, which is faster than PathFree() for long
+	lines, but may be wrong near thin walls and edges.
+
+	The grid is created by the first call of CoarsePathFree() in a round, and
+	is updated where a script changes the landscape, see OnLandscapeChanged().
+	Changes that the engine makes on its own, such as falling or flowing
+	material, are not tracked.
+
+	@note Use it where pixel accuracy does not matter:
+	{@code
+		if (CoarsePathFree(GetX(), GetY(), target->GetX(), target->GetY()))
+		{
+			... // Do stuff
+		}
+	}
+ */
+
+static const VISIBILITY_CellSize = 8;
+
+static visibility_grid; // {Wdt, Hgt, Cells}, see InitVisibilityGrid()
+
+/* --- Interface --- */
+
+// Creates the grid for the whole landscape.
+global func InitVisibilityGrid()
+{
+	visibility_grid =
+	{
+		Wdt = (LandscapeWidth() + VISIBILITY_CellSize - 1) / VISIBILITY_CellSize,
+		Hgt = (LandscapeHeight() + VISIBILITY_CellSize - 1) / VISIBILITY_CellSize,
+		Cells = [],
+	};
+	SetLength(visibility_grid.Cells, visibility_grid.Wdt * visibility_grid.Hgt);
+	UpdateVisibilityGrid(0, 0, LandscapeWidth(), LandscapeHeight());
+	return visibility_grid;
+}
+
+
+// Discards the grid, CoarsePathFree() creates it again when it is needed.
+global func ResetVisibilityGrid()
+{
+	visibility_grid = nil;
+}
+
+
+/**
+	Updates the cells in a rectangle of the landscape.
+	Does nothing if there is no grid yet.
+
+	@par x The left edge, in global coordinates.
+	@par y The top edge, in global coordinates.
+ */
+global func UpdateVisibilityGrid(int x, int y, int wdt, int hgt)
+{
+	if (!visibility_grid) return;
+
+	var left = BoundBy(x / VISIBILITY_CellSize, 0, visibility_grid.Wdt - 1);
+	var top = BoundBy(y / VISIBILITY_CellSize, 0, visibility_grid.Hgt - 1);
+	var right = BoundBy((x + wdt) / VISIBILITY_CellSize, 0, visibility_grid.Wdt - 1);
+	var bottom = BoundBy((y + hgt) / VISIBILITY_CellSize, 0, visibility_grid.Hgt - 1);
+	var center = VISIBILITY_CellSize / 2;
+
+	for (var cell_x = left; cell_x <= right; ++cell_x)
+	{
+		for (var cell_y = top; cell_y <= bottom; ++cell_y)
+		{
+			var solid = GBackSolid(AbsX(cell_x * VISIBILITY_CellSize + center), AbsY(cell_y * VISIBILITY_CellSize + center));
+			visibility_grid.Cells[cell_x + cell_y * visibility_grid.Wdt] = solid;
+		}
+	}
+}
+
+
+/**
+	Checks whether a line is free, on the visibility grid.
+
+	@par x1 The start X position, in global coordinates.
+	@par y1 The start Y position, in global coordinates.
+	@par x2 The end X position, in global coordinates.
+	@par y2 The end Y position, in global coordinates.
+	@par exact If the line is blocked on the grid, PathFree() decides.
+	           The result is the same as PathFree() for blocked lines then,
+	           and only free lines can be wrong.
+ */
+global func CoarsePathFree(int x1, int y1, int x2, int y2, bool exact)
+{
+	if (!visibility_grid)
+	{
+		InitVisibilityGrid();
+	}
+
+	if (IsCoarseLineFree(x1, y1, x2, y2))
+	{
+		return true;
+	}
+	if (exact)
+	{
+		return PathFree(x1, y1, x2, y2);
+	}
+	return false;
+}
+
+
+/**
+	Compares CoarsePathFree() to PathFree() for random lines
+	in the current landscape, and logs the result.
+
+	@par samples The number of lines, 1000 by default.
+	@par max_length The maximum length of the lines, 500 by default.
+ */
+global func LogCoarsePathFreeReport(int samples, int max_length)
+{
+	samples = samples ?? 1000;
+	max_length = max_length ?? 500;
+
+	if (!visibility_grid)
+	{
+		InitVisibilityGrid();
+	}
+
+	var lines = [];
+	for (var i = 0; i < samples; ++i)
+	{
+		var x = Random(LandscapeWidth());
+		var y = Random(LandscapeHeight());
+		PushBack(lines, [x, y, BoundBy(x + RandomX(-max_length, max_length), 0, LandscapeWidth() - 1), BoundBy(y + RandomX(-max_length, max_length), 0, LandscapeHeight() - 1)]);
+	}
+
+	var exact = [], coarse = [];
+	var start_time = GetTime();
+	for (var line in lines)
+	{
+		PushBack(exact, PathFree(line[0], line[1], line[2], line[3]));
+	}
+	var exact_time = GetTime() - start_time;
+
+	start_time = GetTime();
+	for (var line in lines)
+	{
+		PushBack(coarse, CoarsePathFree(line[0], line[1], line[2], line[3]));
+	}
+	var coarse_time = GetTime() - start_time;
+
+	var false_free = 0, false_blocked = 0;
+	for (var i = 0; i < samples; ++i)
+	{
+		if (coarse[i] && !exact[i]) false_free += 1;
+		if (!coarse[i] && exact[i]) false_blocked += 1;
+	}
+	Log("[Benchmark] CoarsePathFree;landscape=%dx%d;samples=%d;max_length=%d;agree=%d;false_free=%d;false_blocked=%d;exact_ms=%d;coarse_ms=%d",
+	    LandscapeWidth(), LandscapeHeight(), samples, max_length, samples - false_free - false_blocked, false_free, false_blocked, exact_time, coarse_time);
+}
+
+/* --- Internals --- */
+
+global func IsCoarseCellSolid(int cell_x, int cell_y)
+{
+	if (cell_x < 0 || cell_y < 0 || cell_x >= visibility_grid.Wdt || cell_y >= visibility_grid.Hgt)
+	{
+		return false;
+	}
+	return visibility_grid.Cells[cell_x + cell_y * visibility_grid.Wdt];
+}
+
+
+// Walks through all cells that the line touches
+global func IsCoarseLineFree(int x1, int y1, int x2, int y2)
+{
+	var size = VISIBILITY_CellSize;
+	var cell_x = x1 / size, cell_y = y1 / size;
+	var end_x = x2 / size, end_y = y2 / size;
+	var dir_x = Sign(x2 - x1), dir_y = Sign(y2 - y1);
+	var dx = Abs(x2 - x1), dy = Abs(y2 - y1);
+
+	// Distance to the next cell border, along each axis
+	var next_x = x1 - cell_x * size;
+	if (dir_x > 0) next_x = (cell_x + 1) * size - x1;
+	var next_y = y1 - cell_y * size;
+	if (dir_y > 0) next_y = (cell_y + 1) * size - y1;
+
+	var steps = Abs(end_x - cell_x) + Abs(end_y - cell_y);
+	for (var i = 0; i < steps; ++i)
+	{
+		if (IsCoarseCellSolid(cell_x, cell_y))
+		{
+			return false;
+		}
+		// Compare next_x / dx with next_y / dy, without division
+		if (dy == 0 || (dx != 0 && next_x * dy < next_y * dx))
+		{
+			cell_x += dir_x;
+			next_x += size;
+		}
+		else
+		{
+			cell_y += dir_y;
+			next_y += size;
+		}
+	}
+	return !IsCoarseCellSolid(end_x, end_y);
+}
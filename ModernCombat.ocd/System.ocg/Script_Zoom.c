@@ -10,6 +10,8 @@ static const CMC_ViewRange_GlobalMin = 200;
 
 static const CMC_ViewRange_Default_Player = 600;
 
+static player_view_offsets; // The last view offset of every player, see GetPlayerViewOffset()
+
 /* --- Functions --- */
 
 global func SetPlayerZoomDefault(int player)
@@ -46,3 +48,32 @@ global func SetPlayerZoomLandscape(int player)
 		SetPlayerZoomByViewRange(player, CMC_ViewRange_GlobalMin, nil, PLRZOOM_LimitMin);
 	}
 }
+
+
+/* --- View offset --- */
+
+// Remembers the offset, because the engine cannot be asked for it
+global func SetViewOffset(int player, int x, int y)
+{
+	if (player >= 0)
+	{
+		player_view_offsets = player_view_offsets ?? [];
+		player_view_offsets[player] = {X = x, Y = y};
+	}
+	return _inherited(player, x, y, ...);
+}
+
+
+/**
+	Gets the view offset that was last set for a player.
+
+	@return proplist {X, Y}, zero if no offset was set.
+ */
+global func GetPlayerViewOffset(int player)
+{
+	if (player >= 0 && player_view_offsets && player < GetLength(player_view_offsets) && player_view_offsets[player])
+	{
+		return player_view_offsets[player];
+	}
+	return {X = 0, Y = 0};
+}
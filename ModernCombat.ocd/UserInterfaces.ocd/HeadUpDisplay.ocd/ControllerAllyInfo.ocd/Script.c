@@ -19,7 +19,6 @@ func Construction()
 {
 	gui_cmc_ally_info = {};
 	gui_cmc_ally_info.Allies = []; // Array with ally info
-	gui_cmc_ally_info.Info = []; // Array with individual slots
 	gui_cmc_ally_info.Menu = new GUI_Element
 	{
 		Target = this,
@@ -28,6 +27,7 @@ func Construction()
 		Priority = GUI_CMC_Priority_HUD,
 	};
 	gui_cmc_ally_info.Menu->Open(GetOwner())->Show()->Update();
+	gui_cmc_ally_info.Info = new GUI_ElementPool{}->Init(gui_cmc_ally_info.Menu, BindCallback(this.AssembleAllyInfoSlot)); // Individual slots
 
 	return _inherited(...);
 }
@@ -171,6 +171,17 @@ func AssembleAllyInfo(int slot)
 }
 
 
+// Slots are below each other, so every slot has a fixed position
+func AssembleAllyInfoSlot(int slot)
+{
+	var info = AssembleAllyInfo(slot);
+	var height = GUI_CMC_Element_Icon_Size + GUI_CMC_Margin_Element_Small_V;
+	info->AlignLeft(GuiDimensionCmc(nil, GUI_CMC_Margin_Screen_H));
+	info->AlignTop(GuiDimensionCmc(nil, GUI_CMC_Margin_Screen_V + slot * height));
+	return info;
+}
+
+
 
 /* --- Drawing / display --- */
 
@@ -217,6 +228,8 @@ local ScheduledAllyInfoUpdateTimer = new Effect
 // Update the ally info
 func UpdateAllyInfo()
 {
+	ProfileBegin("HUD::UpdateAllyInfo");
+
 	UpdateAllyAmount();
 
 	var hide =  GetCursor(GetOwner())->~IsRespawning();
@@ -224,7 +237,7 @@ func UpdateAllyInfo()
 	for (var i = 0; i < GetLength(gui_cmc_ally_info.Allies); ++i)
 	{
 		var ally = gui_cmc_ally_info.Allies[i];
-		var info = gui_cmc_ally_info.Info[i];
+		var info = gui_cmc_ally_info.Info->GetElement(i);
 
 		if (hide)
 		{
@@ -271,46 +284,15 @@ func UpdateAllyInfo()
 			}
 		}
 	}
+
+	ProfileEnd("HUD::UpdateAllyInfo");
 }
 
 
 func UpdateAllyAmount()
 {
-	var old_count = GetLength(gui_cmc_ally_info.Allies);
 	gui_cmc_ally_info.Allies = GetAlliedPlayers(GetOwner());
-	var new_count = GetLength(gui_cmc_ally_info.Allies);
-
-	if (old_count != new_count)
-	{
-		// Need to create more ally info buttons?
-		for (var i = old_count; i < new_count; ++i)
-		{
-			gui_cmc_ally_info.Info[i] = AssembleAllyInfo(i);
-			gui_cmc_ally_info.Info[i]->AddTo(gui_cmc_ally_info.Menu)->Show();
-		}
 
-		// Need to remove some ally info buttons?
-		for (var i = old_count; i > new_count; --i)
-		{
-			var slot = gui_cmc_ally_info.Info[i - 1];
-			GuiClose(gui_cmc_ally_info.Menu->GetRootID(), slot.ID, this);
-		}
-		SetLength(gui_cmc_ally_info.Info, new_count);
-
-		// Adjust positions
-		var margin_small = GuiDimensionCmc(nil, GUI_CMC_Margin_Element_Small_V);
-
-		var position = GuiDimensionCmc(nil, GUI_CMC_Margin_Screen_V);
-
-		for (var i = 0; i < new_count; ++i)
-		{
-			// Align the slot
-			var slot = gui_cmc_ally_info.Info[i];
-			slot->AlignLeft(GuiDimensionCmc(nil, GUI_CMC_Margin_Screen_H));
-			slot->AlignTop(position);
-
-			// Update top position
-			position = slot->GetBottom()->Add(margin_small);
-		}
-	}
+	// Hides or shows the slots, new ones are created only if necessary
+	gui_cmc_ally_info.Info->SetCount(GetLength(gui_cmc_ally_info.Allies));
 }
@@ -3,11 +3,18 @@
 
 	Colors the screen, should be located behind other HUD elements.
 
+	Every crew member has named color layers, such as damage, healing or smoke.
+	The layers are composited into one color, in the order in which they were
+	added, and the GUI is updated only if that color changes. The layers of
+	crew members that were removed are dropped with the next overlay update.
+
 	@author Marky
  */
 
 /* --- Properties --- */
 
+static const ColorOverlay_MaxTracks = 8; // Most flashes per layer at the same time
+
 // Proplist for saving the menu layouts, GUI ID and so on.
 local gui_cmc_color_overlay;
 
@@ -17,6 +24,7 @@ local gui_cmc_color_overlay;
 func Construction()
 {
 	gui_cmc_color_overlay = gui_cmc_color_overlay ?? {};
+	gui_cmc_color_overlay.Targets = {};
 	gui_cmc_color_overlay.Menu = new GUI_Element
 	{
 		Style = GUI_Multiple | GUI_NoCrop | GUI_IgnoreMouse,
@@ -139,58 +147,252 @@ local ScheduledColorOverlayUpdateTimer = new Effect
 
 func UpdateColorOverlay()
 {
+	ProfileBegin("HUD::UpdateColorOverlay");
+
+	RemoveOrphanedColorOverlays();
+
 	var cursor = GetCursor(GetOwner());
 
 	if (gui_cmc_color_overlay.Menu->ShowForCrew(cursor, cursor->~IsRespawning()))
 	{
-		for (var identifier in GetProperties(gui_cmc_color_overlay))
+		for (var for_object in GetProperties(gui_cmc_color_overlay.Targets))
 		{
-			if ("Menu" == identifier)
+			var overlay = gui_cmc_color_overlay.Targets[for_object];
+			if (overlay.Target == cursor)
+			{
+				overlay.Element->Show();
+			}
+			else
 			{
-				continue;
+				overlay.Element->Hide();
 			}
+			overlay.Element->Update();
+		}
+	}
+
+	ProfileEnd("HUD::UpdateColorOverlay");
+}
+
+
+/* --- Functionality --- */
+
+
+/**
+	Sets the color of a layer.
+
+	@par target The crew member.
+	@par identifier The name of the layer.
+	@par color The color, {@code nil} removes the color.
+ */
+public func SetColorLayer(object target, string identifier, int color)
+{
+	var layer = GetColorLayer(target, identifier);
+	if (layer.Color != color)
+	{
+		layer.Color = color;
+		CompositeColorLayers(GetColorOverlay(target));
+	}
+}
+
+
+/**
+	Flashes a layer: The alpha is added to the layer and fades out.
+	Flashes with the same color add up.
+
+	@par target The crew member.
+	@par identifier The name of the layer.
+	@par color The color, the alpha is ignored.
+	@par alpha The alpha at the start of the flash.
+	@par fade_time The flash fades out in this many frames.
+	@par alpha_max The highest alpha of the layer, 250 by default.
+ */
+public func FlashColorLayer(object target, string identifier, int color, int alpha, int fade_time, int alpha_max)
+{
+	var layer = GetColorLayer(target, identifier);
+	if (GetLength(layer.Tracks) > 0 && layer.FlashColor != color)
+	{
+		return;
+	}
+
+	layer.FlashColor = color;
+	layer.AlphaMax = alpha_max ?? layer.AlphaMax ?? 250;
+	PushBack(layer.Tracks, {Start = FrameCounter(), Alpha = alpha, Length = Max(1, fade_time)});
 
-			for (var for_object in GetProperties(gui_cmc_color_overlay[identifier]))
+	// Drop the weakest flash if there are too many
+	if (GetLength(layer.Tracks) > ColorOverlay_MaxTracks)
+	{
+		var weakest = 0;
+		for (var i = 1; i < GetLength(layer.Tracks); ++i)
+		{
+			if (GetTrackAlpha(layer.Tracks[i]) < GetTrackAlpha(layer.Tracks[weakest]))
 			{
-				var overlay = gui_cmc_color_overlay[identifier][for_object];
-				var target = overlay.Target;
-				if (target == cursor)
-				{
-					overlay->Show();
-				}
-				else
+				weakest = i;
+			}
+		}
+		RemoveArrayIndex(layer.Tracks, weakest);
+	}
+
+	CompositeColorLayers(GetColorOverlay(target));
+	GetEffect("ColorOverlayFlashTimer", this) ?? CreateEffect(ColorOverlayFlashTimer, 1, 1);
+}
+
+
+// Fades the flashes of all crew members
+local ColorOverlayFlashTimer = new Effect
+{
+	Timer = func ()
+	{
+		return Target->UpdateColorFlashes();
+	},
+};
+
+
+func UpdateColorFlashes()
+{
+	var active = false;
+	for (var for_object in GetProperties(gui_cmc_color_overlay.Targets))
+	{
+		var overlay = gui_cmc_color_overlay.Targets[for_object];
+		if (!overlay.Target)
+		{
+			continue;
+		}
+		var flashing = false;
+		for (var layer in overlay.Layers)
+		{
+			// Drop finished flashes
+			for (var i = GetLength(layer.Tracks) - 1; i >= 0; --i)
+			{
+				if (GetTrackAlpha(layer.Tracks[i]) <= 0)
 				{
-					overlay->Hide();
+					RemoveArrayIndex(layer.Tracks, i);
 				}
-
-				overlay->Update();
 			}
+			flashing = flashing || GetLength(layer.Tracks) > 0 || layer.Flashed;
+			layer.Flashed = GetLength(layer.Tracks) > 0;
+		}
+		if (flashing)
+		{
+			CompositeColorLayers(overlay);
+			active = true;
 		}
 	}
+	if (!active)
+	{
+		return FX_Execute_Kill;
+	}
+	return FX_OK;
 }
 
 
-/* --- Functionality --- */
+// Alpha of a flash in the current frame
+func GetTrackAlpha(proplist track)
+{
+	var remaining = track.Start + track.Length - FrameCounter();
+	if (remaining <= 0)
+	{
+		return 0;
+	}
+	return track.Alpha * Min(remaining, track.Length) / track.Length;
+}
+
+
+// Blends all layers of a crew member, and updates the GUI if the result changed
+func CompositeColorLayers(proplist overlay)
+{
+	var r = 0, g = 0, b = 0, alpha = 0;
+	for (var layer in overlay.Layers)
+	{
+		var color = layer.Color;
+		if (GetLength(layer.Tracks) > 0)
+		{
+			var flash_alpha = 0;
+			for (var track in layer.Tracks)
+			{
+				flash_alpha += GetTrackAlpha(track);
+			}
+			flash_alpha = BoundBy(flash_alpha, 0, layer.AlphaMax);
+			color = SetRGBaValue(layer.FlashColor, flash_alpha, RGBA_ALPHA);
+		}
+		if (color == nil) continue;
+
+		// Blend the layer over the previous layers
+		var layer_rgba = SplitRGBaValue(color);
+		var layer_alpha = layer_rgba.Alpha;
+		if (layer_alpha == 0) continue;
+		var below = alpha * (255 - layer_alpha) / 255;
+		var combined = layer_alpha + below;
+		r = (layer_rgba.R * layer_alpha + r * below) / combined;
+		g = (layer_rgba.G * layer_alpha + g * below) / combined;
+		b = (layer_rgba.B * layer_alpha + b * below) / combined;
+		alpha = combined;
+	}
+
+	var composite = nil;
+	if (alpha > 0)
+	{
+		composite = RGBa(r, g, b, alpha);
+	}
+	if (composite != overlay.Composite)
+	{
+		overlay.Composite = composite;
+		overlay.Element->Update({BackgroundColor = composite});
+	}
+}
 
 
 // Adds the layer if it is not there
 func GetColorLayer(object target, string identifier)
 {
-	if (!gui_cmc_color_overlay[identifier])
+	var overlay = GetColorOverlay(target);
+	for (var layer in overlay.Layers)
 	{
-		gui_cmc_color_overlay[identifier] = {};
+		if (layer.Identifier == identifier)
+		{
+			return layer;
+		}
 	}
+	var layer = {Identifier = identifier, Color = nil, Tracks = []};
+	PushBack(overlay.Layers, layer);
+	return layer;
+}
+
+
+// Adds the GUI element for a crew member if it is not there
+func GetColorOverlay(object target)
+{
 	var for_object = Format("object%d", target->ObjectNumber());
-	if (!gui_cmc_color_overlay[identifier][for_object])
+	if (!gui_cmc_color_overlay.Targets[for_object])
 	{
-		gui_cmc_color_overlay[identifier][for_object] = new GUI_Element
+		var element = new GUI_Element
 		{ 
+			ID = target->ObjectNumber(), // For closing the element when the crew member is gone
 			Target = target,
 			Style = GUI_Multiple | GUI_NoCrop | GUI_IgnoreMouse,
 		};
-		gui_cmc_color_overlay[identifier][for_object]->SetWidth(1000)->SetHeight(1000);
-		gui_cmc_color_overlay[identifier][for_object]->AddTo(gui_cmc_color_overlay.Menu)->Show();
+		element->SetWidth(1000)->SetHeight(1000);
+		element->AddTo(gui_cmc_color_overlay.Menu)->Show();
+		gui_cmc_color_overlay.Targets[for_object] = {Target = target, Element = element, Layers = [], Composite = nil};
 	}
+	return gui_cmc_color_overlay.Targets[for_object];
+}
 
-	return gui_cmc_color_overlay[identifier][for_object];
+
+// Closes the GUI elements of crew members that were removed
+func RemoveOrphanedColorOverlays()
+{
+	var targets = {};
+	for (var for_object in GetProperties(gui_cmc_color_overlay.Targets))
+	{
+		var overlay = gui_cmc_color_overlay.Targets[for_object];
+		if (overlay.Target)
+		{
+			targets[for_object] = overlay;
+		}
+		else
+		{
+			GuiClose(gui_cmc_color_overlay.Menu->GetRootID(), overlay.Element.ID);
+		}
+	}
+	gui_cmc_color_overlay.Targets = targets;
 }
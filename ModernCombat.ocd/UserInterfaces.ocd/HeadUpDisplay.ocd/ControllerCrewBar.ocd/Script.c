@@ -232,6 +232,8 @@ local ScheduledCrewBarsUpdateTimer = new Effect
 // Update the bars
 func UpdateCrewBars(bool update_health, bool update_breath)
 {
+	ProfileBegin("HUD::UpdateCrewBars");
+
 	var cursor = GetCursor(GetOwner());
 
 	if (gui_cmc_crew.Menu->ShowForCrew(cursor, cursor->~IsRespawning() || cursor->~IsIncapacitated()))
@@ -262,4 +264,6 @@ func UpdateCrewBars(bool update_health, bool update_breath)
 			GetBreathBar()->Update();
 		}
 	}
+
+	ProfileEnd("HUD::UpdateCrewBars");
 }
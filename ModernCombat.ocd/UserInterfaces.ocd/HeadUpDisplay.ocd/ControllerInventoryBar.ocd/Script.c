@@ -184,6 +184,8 @@ local ScheduledInventoryUpdateTimer = new Effect
 // Update the inventory
 func UpdateInventory(bool selection_changed)
 {
+	ProfileBegin("HUD::UpdateInventory");
+
 	var cursor = GetCursor(GetOwner());
 
 	if (gui_cmc_inventory.Menu->ShowForCrew(cursor, cursor->~IsRespawning() || cursor->~IsIncapacitated()))
@@ -207,6 +209,8 @@ func UpdateInventory(bool selection_changed)
 			slot->SetInfo(item, item_index == selected_item_index);
 		}
 	}
+
+	ProfileEnd("HUD::UpdateInventory");
 }
 
 
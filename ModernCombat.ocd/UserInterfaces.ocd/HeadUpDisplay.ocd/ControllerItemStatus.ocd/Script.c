@@ -368,6 +368,8 @@ local ScheduledItemStatusUpdateTimer = new Effect
 // Update the bars
 func UpdateItemStatus()
 {
+	ProfileBegin("HUD::UpdateItemStatus");
+
 	var cursor = GetCursor(GetOwner());
 
 	if (gui_cmc_item_status.Menu->ShowForCrew(cursor, cursor->~IsRespawning() || cursor->~IsIncapacitated()))
@@ -457,6 +459,8 @@ func UpdateItemStatus()
 		GetObjectConfiguration()->Update();
 		gui_cmc_item_status.Grenade_Icon->Update();
 	}
+
+	ProfileEnd("HUD::UpdateItemStatus");
 }
 
 /* --- Misc --- */
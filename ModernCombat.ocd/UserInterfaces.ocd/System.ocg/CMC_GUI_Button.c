@@ -77,7 +77,7 @@ static const CMC_GUI_Button = new GUI_Element
 			else
 			{
 				GuiPlaySoundConfirm(this.GUI_Owner);
-				DoCallback(this.Tab_Callback);
+				InvokeCallback(this.Tab_Callback);
 			}
 		}
 	},
@@ -110,7 +110,7 @@ static const CMC_GUI_Button = new GUI_Element
 			if (IsTabButton() && this.Tab_Callback && selected && !skip_callback)
 			{
 				GuiPlaySoundSelect(this.GUI_Owner);
-				DoCallback(this.Tab_Callback);
+				InvokeCallback(this.Tab_Callback);
 			}
 		}
 		return this;
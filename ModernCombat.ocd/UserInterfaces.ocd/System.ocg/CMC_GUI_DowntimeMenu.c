@@ -41,7 +41,7 @@ static const CMC_GUI_DowntimeMenu = new GUI_Element
 			               ->AssignPlayerControl(target->GetOwner(), CON_CMC_GameSettings)
 			               ->AlignRight(1000)
 			               ->AlignBottom(1000)
-			               ->SetData("$ButtonLabelSettings$", DefineCallback(this.ShowSettings))
+			               ->SetData("$ButtonLabelSettings$", BindCallback(this.ShowSettings))
 			               ->AddTo(main);
 
 			// Button for scoreboard
@@ -50,7 +50,7 @@ static const CMC_GUI_DowntimeMenu = new GUI_Element
 			                 ->AssignButtonHint(target->GetOwner(), "Tab")
 			                 ->AlignLeft()
 			                 ->AlignBottom(1000)
-			                 ->SetData("$ButtonLabelScoreboard$", DefineCallback(this.ShowScoreboard))
+			                 ->SetData("$ButtonLabelScoreboard$", BindCallback(this.ShowScoreboard))
 			                 ->AddTo(main);
 
 			// The actual box
@@ -80,7 +80,7 @@ static const CMC_GUI_RespawnMenu = new CMC_GUI_DowntimeMenu
 		button_overview->Assemble()
 		               ->SetWidth(1000)
 		               ->SetHeight(icon_size)
-		               ->SetData("$OverviewButtonLabel$", DefineCallback(Global.SetPlayerZoomLandscape, this.Target->GetOwner()))
+		               ->SetData("$OverviewButtonLabel$", BindCallback(Global.SetPlayerZoomLandscape, this.Target->GetOwner()))
 		               ->AddTo(box_right);
 		GUI_Components[ComponentIndex_OverviewButton] = button_overview;
 
@@ -279,7 +279,7 @@ static const CMC_GUI_RespawnMenu_OverviewButton = new CMC_GUI_RespawnMenu_TabBut
 	{
 		if (this.Tab_Callback)
 		{
-			DoCallback(this.Tab_Callback);
+			InvokeCallback(this.Tab_Callback);
 		}
 	},
 };
@@ -426,7 +426,7 @@ static const CMC_GUI_RespawnMenu_LocationButton = new CMC_GUI_RespawnMenu_TabBut
 		this.label.Text = location->GetName();
 		this.ToolTip = location.Description;
 		Update({ label = {Text = this.label.Text}, ToolTip = this.ToolTip});
-		this.Tab_Callback = this->DefineCallback(this.ZoomTo);
+		this.Tab_Callback = this->BindCallback(this.ZoomTo);
 		return this;
 	},
 
@@ -855,17 +855,18 @@ static const GUI_Element = new Global
 		return GetPrototype(other) == GetPrototype(this) || IsValueInArray(prototypes, GUI_Element);
 	},
 
+	// Names are counted up per parent, so that the names are the same in every game and a name is never used twice
 	GetValidElementName = func (proplist parent)
 	{
-		for (var tries = 10000; tries > 0; --tries)
+		var index = parent.GUI_Element_NameCount ?? 0;
+		var element_name = Format("gui_element_%d", index);
+		while (GetProperty(element_name, parent) != nil)
 		{
-			var element_name = Format("gui_element_%d%d%d%d%d", Random(10), Random(10), Random(10), Random(10), Random(10));
-			if (GetProperty(element_name, parent) == nil)
-			{
-				return element_name;
-			}
+			index += 1;
+			element_name = Format("gui_element_%d", index);
 		}
-		FatalError("Cannot find anonymous name for new GUI sub window");
+		parent.GUI_Element_NameCount = index + 1;
+		return element_name;
 	},
 
 	InitPosition = func ()
@@ -882,3 +883,105 @@ static const GUI_Element = new Global
 		return this;
 	}
 };
+
+
+/**
+	Pool of GUI elements in a parent element.
+
+	Elements are hidden instead of closed if the list gets shorter, and
+	are shown again if it gets longer, so that changing the amount of
+	elements costs only GUI updates.
+
+	@note Use it like this:
+	{@code
+		var pool = new GUI_ElementPool{}->Init(menu, BindCallback(this.AssembleEntry));
+		pool->SetCount(5);
+		pool->GetElement(2)->...
+	}
+ */
+static const GUI_ElementPool = new Global
+{
+	Pool_Parent = nil,   // Array that contains the parent element, to avoid infinite proplist recursion
+	Pool_Assemble = nil, // Callback that creates a new element, gets the index of the element
+	Pool_Elements = nil, // Array of all elements that were created
+	Pool_Count = 0,      // This many elements are in use
+
+	/**
+		Sets the parent and the callback for new elements.
+
+		@par parent The elements are added to this element.
+		@par assemble This callback creates a new element.
+		              The index of the element is passed as an additional parameter.
+
+		@return proplist The pool, for calling further functions.
+	 */
+	Init = func (proplist parent, array assemble)
+	{
+		this.Pool_Parent = [parent];
+		this.Pool_Assemble = assemble;
+		this.Pool_Elements = [];
+		this.Pool_Count = 0;
+		return this;
+	},
+
+	/**
+		Changes the amount of elements in use.
+		New elements are created only if there are not enough hidden elements.
+
+		@return proplist The pool, for calling further functions.
+	 */
+	SetCount = func (int count)
+	{
+		var old_count = this.Pool_Count;
+
+		// Show hidden elements, create new ones if necessary
+		for (var i = old_count; i < count; ++i)
+		{
+			var element = this.Pool_Elements[i];
+			if (element)
+			{
+				element->Show()->Update({Player = element.Player});
+			}
+			else
+			{
+				element = InvokeCallback(this.Pool_Assemble, i);
+				element->AddTo(this.Pool_Parent[0])->Show();
+				this.Pool_Elements[i] = element;
+			}
+		}
+
+		// Hide elements that are not needed anymore
+		for (var i = count; i < old_count; ++i)
+		{
+			var element = this.Pool_Elements[i];
+			element->Hide()->Update({Player = element.Player});
+		}
+
+		this.Pool_Count = count;
+		return this;
+	},
+
+	/**
+		Gets the amount of elements in use.
+	 */
+	GetCount = func ()
+	{
+		return this.Pool_Count;
+	},
+
+	/**
+		Gets an element that is in use.
+
+		@par index The index of the element.
+
+		@return proplist The element, or {@code nil} if the element is not in use.
+	 */
+	GetElement = func (int index)
+	{
+		if (index >= 0 && index < this.Pool_Count)
+		{
+			return this.Pool_Elements[index];
+		}
+		return nil;
+	},
+};
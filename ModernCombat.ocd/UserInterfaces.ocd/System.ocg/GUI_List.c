@@ -179,28 +179,28 @@ static const GUI_List_Entry = new GUI_Element
 
 	OnClickCall = func ()
 	{
-		DoCallback(this.ListEntry_Callback_OnClick);
+		InvokeCallback(this.ListEntry_Callback_OnClick);
 	},
 
 	OnMouseInCall = func ()
 	{
 		this.ListEntry_Hovered = true;
 		this->~UpdateEntry();
-		DoCallback(this.ListEntry_Callback_OnMouseIn);
+		InvokeCallback(this.ListEntry_Callback_OnMouseIn);
 	},
 
 	OnMouseOutCall = func ()
 	{
 		this.ListEntry_Hovered = false;
 		this->~UpdateEntry();
-		DoCallback(this.ListEntry_Callback_OnMouseOut);
+		InvokeCallback(this.ListEntry_Callback_OnMouseOut);
 	},
 
 	OnMenuClosedCall = func ()
 	{
 		if (this.ListEntry_Callback_OnMenuClosed)
 		{
-			DoCallback(this.ListEntry_Callback_OnMenuClosed);
+			InvokeCallback(this.ListEntry_Callback_OnMenuClosed);
 		}
 	}
 };
@@ -225,7 +225,7 @@ static const GUI_SelectionListEntry = new GUI_List_Entry
 		// Issue a callback?
 		if (this.ListEntry_Callback_OnSelected && selected && !skip_callback)
 		{
-			DoCallback(this.ListEntry_Callback_OnSelected);
+			InvokeCallback(this.ListEntry_Callback_OnSelected);
 		}
 		return this; // Return value of 'nil' means that the item cannot be selected/deselected
 	},
@@ -8,6 +8,13 @@ func InitializeAmbience()
 }
 
 
+// Ramps and hatches are restored from the first round
+public func UseRoundSnapshot()
+{
+	return true;
+}
+
+
 func CreateInterior()
 {
 	_inherited(...);
@@ -7,6 +7,13 @@ func InitializeAmbience()
 	_inherited(...);
 }
 
+// Ramps are restored from the first round
+public func UseRoundSnapshot()
+{
+	return true;
+}
+
+
 func CreateInterior()
 {
 	_inherited(...);
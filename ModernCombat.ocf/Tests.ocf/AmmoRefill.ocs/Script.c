@@ -0,0 +1,195 @@
+/**
+	Unit test for refillable packs
+ */
+
+static player_carrier;
+
+
+func Initialize()
+{
+	// Create script players for these tests.
+	CreateScriptPlayer("Carrier", RGB(0, 0, 255), nil, CSPF_NoEliminationCheck);
+}
+
+
+func InitializePlayer(int player)
+{
+	// Initialize script player.
+	if (GetPlayerType(player) == C4PT_Script)
+	{
+		// Store the player numbers.
+		if (GetPlayerName(player) == "Carrier")
+		{
+			player_carrier = player;
+		}
+		return;
+	}
+
+	// Set zoom to full map size.
+	SetPlayerZoomByViewRange(player, LandscapeWidth(), nil, PLRZOOM_Direct);
+
+	// No FoW to see everything happening.
+	SetFoW(false, player);
+
+	// Move normal players into a relaunch container.
+	var relaunch = CreateObject(RelaunchContainer, LandscapeWidth() / 2, LandscapeHeight() / 2);
+	GetCrew(player)->Enter(relaunch);
+
+	// Tests that finish right away do not wait for the next frame
+	SetTestBatchMode(true);
+	LaunchTest(1);
+	return true;
+}
+
+/* --- Some helper things --- */
+
+global func GetPlayerName(int player)
+{
+	if (player == NO_OWNER)
+		return "NO_OWNER";
+	return _inherited(player, ...);
+}
+
+
+global func InitTest()
+{
+	// Remove all objects except the player crew members and relaunch container they are in.
+	for (var obj in FindObjects(Find_Not(Find_Or(Find_ID(RelaunchContainer), Find_Category(C4D_Rule)))))
+		if (!((obj->GetOCF() & OCF_CrewMember) && GetPlayerType(obj->GetOwner()) == C4PT_User))
+			obj->RemoveObject();
+
+	// Give script players new crew.
+	var clonk = CreateObjectAbove(Peacemaker, 100, 150, player_carrier);
+	clonk->MakeCrewMember(player_carrier);
+	clonk->SetDir(DIR_Right);
+	SetCursor(player_carrier, clonk);
+
+	// The pack, with a callback that records when it is full again
+	var pack = clonk->CreateContents(CMC_Tool_Defibrillator);
+	pack.OnAmmoCountChange = Global.RecordAmmoCountChange;
+	CurrentTest().pack = pack;
+	CurrentTest().pack_created = FrameCounter();
+	CurrentTest().full_frame = nil;
+	return true;
+}
+
+
+global func RecordAmmoCountChange(int change)
+{
+	if (this->GetAmmoCount() >= this->MaxAmmo() && CurrentTest().full_frame == nil)
+	{
+		CurrentTest().full_frame = FrameCounter();
+	}
+	return Call(CMC_Tool_Defibrillator.OnAmmoCountChange, change);
+}
+
+
+// The refill timer fires every interval frames, counted from the creation of the pack
+global func GetExpectedFullFrame(int emptied)
+{
+	var interval = 35;
+	var created = CurrentTest().pack_created;
+	var first_refill = created + interval * ((emptied - created) / interval + 1);
+	return first_refill + (CMC_Tool_Defibrillator->MaxAmmo() - 1) * interval;
+}
+
+
+// Refill timer and the test may run in any order, so avoid frames where both happen
+global func IsRefillFrame()
+{
+	return (FrameCounter() - CurrentTest().pack_created) % 35 == 0;
+}
+
+/* --- Tests --- */
+
+global func Refill_Timeout() { return 40 * 35; }
+
+//--------------------------------------------------------
+
+global func Test1_OnStart(int player){ return InitTest(); }
+global func Test1_OnFinished(){ return; }
+global func Test1_Execute()
+{
+	var test = CurrentTest();
+	var pack = test.pack;
+	if (test.emptied)
+	{
+		if (test.full_frame)
+		{
+			doTest("Pack was full at frame %d, expected %d", test.full_frame, test.expected);
+			return Evaluate();
+		}
+		else if (FrameCounter() > test.emptied + Refill_Timeout())
+		{
+			return FailTest();
+		}
+		return Wait(10);
+	}
+	else if (!test.settled)
+	{
+		Log("Test that a carried pack refills in the same frames as before");
+		// Let the refill timer run once, so that it notices that the pack is full
+		test.settled = true;
+		return Wait(40);
+	}
+	else
+	{
+		if (IsRefillFrame()) return Wait(1);
+
+		doTest("Pack is full, ammo is %d, expected %d", pack->GetAmmoCount(), pack->MaxAmmo());
+		doTest("Refill effect of a full pack is dormant, interval is %d, expected %d", GetEffect("RefillAmmoEffect", pack).Interval, 0);
+
+		pack->DoAmmoCount(-pack->GetAmmoCount());
+		test.emptied = FrameCounter();
+		test.expected = GetExpectedFullFrame(test.emptied);
+
+		doTest("Refill effect of an empty pack is active, interval is %d, expected %d", GetEffect("RefillAmmoEffect", pack).Interval, 35);
+		return Wait(10);
+	}
+}
+
+//--------------------------------------------------------
+
+global func Test2_OnStart(int player){ return InitTest(); }
+global func Test2_OnFinished(){ return; }
+global func Test2_Execute()
+{
+	var test = CurrentTest();
+	var pack = test.pack;
+	var clonk = GetCrew(player_carrier);
+	if (test.collected)
+	{
+		if (test.full_frame)
+		{
+			doTest("Pack was full at frame %d, expected %d", test.full_frame, test.expected);
+			return Evaluate();
+		}
+		else if (FrameCounter() > test.collected + Refill_Timeout())
+		{
+			return FailTest();
+		}
+		return Wait(10);
+	}
+	else if (test.dropped)
+	{
+		if (IsRefillFrame()) return Wait(1);
+
+		doTest("Pack on the ground did not refill, ammo is %d, expected %d", pack->GetAmmoCount(), 0);
+		doTest("Refill effect of a pack on the ground is dormant, interval is %d, expected %d", GetEffect("RefillAmmoEffect", pack).Interval, 0);
+
+		clonk->Collect(pack);
+		test.collected = FrameCounter();
+		test.expected = GetExpectedFullFrame(test.collected);
+
+		doTest("Refill effect of a collected pack is active, interval is %d, expected %d", GetEffect("RefillAmmoEffect", pack).Interval, 35);
+		return Wait(10);
+	}
+	else
+	{
+		Log("Test that a pack on the ground does not refill until it is collected");
+		pack->Exit();
+		pack->DoAmmoCount(-pack->GetAmmoCount());
+		test.dropped = FrameCounter();
+		return Wait(100);
+	}
+}
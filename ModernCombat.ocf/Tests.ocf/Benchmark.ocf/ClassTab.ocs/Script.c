@@ -0,0 +1,78 @@
+/**
+	Benchmark for the class tab in the respawn menu
+
+	Measures the script time of the class tab contents per tab switch: Once
+	assembled for every switch, like the respawn menu did before the layouts
+	were cached, and once copied from the cached layout of the class.
+ */
+
+static const Benchmark_Switches = 100;
+
+
+func InitializePlayer(int player)
+{
+	// Set zoom to full map size.
+	SetPlayerZoomByViewRange(player, LandscapeWidth(), nil, PLRZOOM_Direct);
+
+	// No FoW to see everything happening.
+	SetFoW(false, player);
+
+	// Move normal players into a relaunch container.
+	var relaunch = CreateObject(RelaunchContainer, LandscapeWidth() / 2, LandscapeHeight() / 2);
+	GetCrew(player)->Enter(relaunch);
+
+	// The benchmarks do not wait for frames
+	SetTestBatchMode(true);
+	LaunchTest(1);
+	return true;
+}
+
+/* --- Some helper things --- */
+
+global func RunBenchmark(string mode)
+{
+	for (var class in Peacemaker->GetAvailableClasses())
+	{
+		var start_time = GetTime();
+		for (var i = 0; i < Benchmark_Switches; ++i)
+		{
+			if (mode == "cached")
+			{
+				class->CopyClassTabLayout();
+			}
+			else
+			{
+				class->AssembleClassTabLayout();
+			}
+		}
+		Log("[Benchmark] ClassTab;mode=%s;class=%i;switches=%d;time_ms=%d", mode, class, Benchmark_Switches, GetTime() - start_time);
+	}
+}
+
+/* --- Tests --- */
+
+//--------------------------------------------------------
+
+global func Test1_OnStart(int player){ return true; }
+global func Test1_OnFinished(){ return; }
+global func Test1_Execute()
+{
+	Log("Class tab assembled for every switch");
+	RunBenchmark("assembled");
+	return PassTest();
+}
+
+//--------------------------------------------------------
+
+global func Test2_OnStart(int player){ return true; }
+global func Test2_OnFinished(){ return; }
+global func Test2_Execute()
+{
+	Log("Class tab copied from the cached layout");
+	RunBenchmark("cached");
+	for (var class in Peacemaker->GetAvailableClasses())
+	{
+		doTest(Format("Copy of the layout of %i is the same as the assembled layout: %s, expected %s", class, "%v", "%v"), DeepEqual(class->CopyClassTabLayout(), class->AssembleClassTabLayout()), true);
+	}
+	return Evaluate();
+}
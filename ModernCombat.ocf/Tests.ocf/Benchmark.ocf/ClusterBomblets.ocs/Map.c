@@ -0,0 +1,10 @@
+/**
+	Flat earth ground for the cluster bomblets benchmark.
+ */
+
+func InitializeMap(proplist map)
+{
+	map->Resize(64, 40);
+	map->Draw("Earth", nil, [0, 20, 64, 20]);
+	return true;
+}
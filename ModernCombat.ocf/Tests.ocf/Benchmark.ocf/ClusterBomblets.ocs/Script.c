@@ -0,0 +1,216 @@
+/**
+	Benchmark for the explosion queue
+
+	Detonates the bomblets of a cluster shot from the grenade launcher in the
+	same frame, between a group of crew members. This is done once with every
+	blast resolved on its own and once with the explosion queue.
+	Also checks that queued explosions still hit and kill in the same frame.
+ */
+
+static const Benchmark_Bomblets = 6;
+static const Benchmark_Rounds = 20;
+static const Benchmark_CrewCount = 8;
+
+
+func InitializePlayer(int player)
+{
+	// Set zoom to full map size.
+	SetPlayerZoomByViewRange(player, LandscapeWidth(), nil, PLRZOOM_Direct);
+
+	// No FoW to see everything happening.
+	SetFoW(false, player);
+
+	// Move normal players into a relaunch container.
+	var relaunch = CreateObject(RelaunchContainer, LandscapeWidth() / 2, LandscapeHeight() / 2);
+	GetCrew(player)->Enter(relaunch);
+
+	LaunchTest(1);
+	return true;
+}
+
+/* --- Some helper things --- */
+
+global func InitBenchmark(bool use_queue)
+{
+	// Remove all objects except the player crew members and relaunch container they are in.
+	for (var obj in FindObjects(Find_Not(Find_ID(RelaunchContainer))))
+		if (obj && !((obj->GetOCF() & OCF_CrewMember) && (GetPlayerType(obj->GetOwner()) == C4PT_User)))
+			obj->RemoveObject();
+
+	SetExplosionQueue(use_queue);
+
+	// Crew members around the impact, they survive all blasts
+	var ground = LandscapeHeight() / 2;
+	for (var i = 0; i < Benchmark_CrewCount; ++i)
+	{
+		var crew = CreateObjectAbove(Peacemaker, LandscapeWidth() / 2 + (i - Benchmark_CrewCount / 2) * 8, ground - 1, NO_OWNER);
+		crew.MaxEnergy = 100000000;
+		crew->DoEnergy(crew.MaxEnergy / 1000);
+	}
+	CurrentTest().round = nil;
+	return true;
+}
+
+
+global func RunBenchmark(string mode)
+{
+	var test = CurrentTest();
+	if (test.round == nil)
+	{
+		test.round = 0;
+		test.time = 0;
+		test.counters = GetExplosionQueueCounters();
+	}
+
+	if (test.round < Benchmark_Rounds)
+	{
+		// Bomblets land close to each other
+		var ground = LandscapeHeight() / 2;
+		var bomblets = [];
+		for (var i = 0; i < Benchmark_Bomblets; ++i)
+		{
+			PushBack(bomblets, CreateObject(CMC_Projectile_FragmentationShell, LandscapeWidth() / 2 + RandomX(-6, 6), ground - 3, NO_OWNER));
+		}
+
+		var start_time = GetTime();
+		for (var bomblet in bomblets)
+		{
+			bomblet->Detonate();
+		}
+		ResolveExplosionQueue();
+		test.time += GetTime() - start_time;
+
+		// Remove the fragments, the next round starts without them
+		RemoveAll(Find_ID(CMC_Effect_ShrapnelField), Find_AnyLayer());
+		test.round += 1;
+		return Wait(1);
+	}
+
+	var counters = GetExplosionQueueCounters();
+	test.blasts = counters.blasts - test.counters.blasts;
+	test.searches = counters.searches - test.counters.searches;
+	test.shockwaves = counters.shockwaves - test.counters.shockwaves;
+	test.effects = counters.effects - test.counters.effects;
+	Log("[Benchmark] ClusterBomblets;mode=%s;bomblets=%d;rounds=%d;time_ms=%d;blasts=%d;searches=%d;shockwaves=%d;effects=%d",
+	    mode, Benchmark_Bomblets, Benchmark_Rounds, test.time, test.blasts, test.searches, test.shockwaves, test.effects);
+	test.round = nil;
+	SetExplosionQueue(true);
+	return PassTest();
+}
+
+/* --- Tests --- */
+
+//--------------------------------------------------------
+
+global func Test1_OnStart(int player)
+{
+	Log("Cluster bomblets without explosion queue");
+	return InitBenchmark(false);
+}
+global func Test1_OnFinished(){ return; }
+global func Test1_Execute()
+{
+	var result = RunBenchmark("immediate");
+	if (CurrentTest().round == nil)
+	{
+		doTest("Created %d shockwaves, expected %d", CurrentTest().shockwaves, Benchmark_Bomblets * Benchmark_Rounds);
+		return Evaluate();
+	}
+	return result;
+}
+
+//--------------------------------------------------------
+
+global func Test2_OnStart(int player)
+{
+	Log("Cluster bomblets with explosion queue");
+	return InitBenchmark(true);
+}
+global func Test2_OnFinished(){ return; }
+global func Test2_Execute()
+{
+	var result = RunBenchmark("queue");
+	if (CurrentTest().round == nil)
+	{
+		// Bomblets within the merge distance share one shockwave and effect
+		doTest("Created fewer shockwaves: %v, expected %v", CurrentTest().shockwaves < Benchmark_Bomblets * Benchmark_Rounds, true);
+		doTest("Created fewer effects: %v, expected %v", CurrentTest().effects < Benchmark_Bomblets * Benchmark_Rounds, true);
+		return Evaluate();
+	}
+	return result;
+}
+
+//--------------------------------------------------------
+
+global func Test3_OnStart(int player)
+{
+	Log("A blast detonates a grenade, and the blast of the grenade is resolved, too");
+	return InitBenchmark(true);
+}
+global func Test3_OnFinished(){ return; }
+global func Test3_Execute()
+{
+	var ground = LandscapeHeight() / 2;
+	var grenade = CreateObject(CMC_Grenade_Field, LandscapeWidth() / 2 + 5, ground - 3, NO_OWNER);
+	var source = CreateObject(Rock, LandscapeWidth() / 2, ground - 3, NO_OWNER);
+	var counters = GetExplosionQueueCounters();
+
+	source->Explosion([30], [60], true);
+	ResolveExplosionQueue();
+
+	doTest("Grenade was detonated: %v, expected %v", grenade == nil, true);
+	doTest("Resolved %d blasts, expected %d", GetExplosionQueueCounters().blasts - counters.blasts, 2);
+	doTest("Blasts left in the queue: %d, expected %d", GetLength(GetExplosionQueue().blasts), 0);
+	RemoveAll(Find_ID(CMC_Effect_ShrapnelField), Find_AnyLayer());
+	return Evaluate();
+}
+
+//--------------------------------------------------------
+
+global func Test4_OnStart(int player)
+{
+	Log("An explosion during the object execution deals its damage in the same frame, by the controller of the source");
+	CurrentTest().player = player;
+	return InitBenchmark(true);
+}
+global func Test4_OnFinished(){ return; }
+global func Test4_Execute()
+{
+	var test = CurrentTest();
+	if (!test.victim)
+	{
+		var ground = LandscapeHeight() / 2;
+		test.target = CreateObject(Rock, LandscapeWidth() / 2 + 5, ground - 3, NO_OWNER);
+		test.target.Damage = Global.Test4_RecordDamageFrame;
+		test.victim = CreateObjectAbove(Peacemaker, LandscapeWidth() / 2 - 5, ground - 1, NO_OWNER);
+		test.victim->DoEnergy(1 - test.victim->GetEnergy());
+		test.grenade = CreateObject(CMC_Grenade_Field, LandscapeWidth() / 2 + 10, ground - 3, NO_OWNER);
+		var source = CreateObject(Rock, LandscapeWidth() / 2, ground - 3, test.player);
+		source->SetController(test.player);
+		source->CreateEffect(Test4_FxExplode, 1, 5);
+		return Wait(10);
+	}
+
+	doTest("Damage was dealt in frame %d, expected %d", test.target.damage_frame, test.explosion_frame);
+	doTest("Victim was killed: %v, expected %v", test.victim->GetAlive(), false);
+	doTest("Victim was killed by player %d, expected %d", test.victim->GetKiller(), test.player);
+	doTest("Grenade was detonated: %v, expected %v", test.grenade == nil, true);
+	doTest("Blasts left in the queue: %d, expected %d", GetLength(GetExplosionQueue().blasts), 0);
+	RemoveAll(Find_ID(CMC_Effect_ShrapnelField), Find_AnyLayer());
+	return Evaluate();
+}
+
+global func Test4_RecordDamageFrame()
+{
+	this.damage_frame = this.damage_frame ?? FrameCounter();
+}
+
+static const Test4_FxExplode = new Effect
+{
+	Timer = func ()
+	{
+		CurrentTest().explosion_frame = FrameCounter();
+		Target->Explosion([30], [60], true);
+		return FX_Execute_Kill;
+	},
+};
@@ -0,0 +1,15 @@
+/**
+	Flat ground with some cover for the combat load benchmark.
+ */
+
+func InitializeMap(proplist map)
+{
+	map->Resize(160, 50);
+	map->Draw("Earth", nil, [0, 40, 80, 10]);
+	map->Draw("Brick", nil, [80, 40, 80, 10]);
+
+	// Cover between the teams
+	map->Draw("Brick", nil, [60, 36, 2, 4]);
+	map->Draw("Granite", nil, [98, 36, 2, 4]);
+	return true;
+}
@@ -0,0 +1,294 @@
+/**
+	Combat load benchmark
+
+	Two teams of scripted bots fight through a fixed sequence of phases:
+	rifle duels, shotgun close combat, grenade spam, smoke and phosphor,
+	missile barrages and a fight over a flag post. Every bot gets the
+	loadout of its class.
+
+	Every phase runs for Benchmark_PhaseFrames frames and logs one line:
+	[Benchmark] CombatLoad;phase=...;bots=...;frames=...;objects=...;particles=...;requested_particles=...;time_ms=...;script_ms=...
+	followed by the particle counters of every category in that phase:
+	[Particles] ...;emitted=...;requested=...
+
+	The bots act only on fixed frames and the scenario has a fixed random
+	seed, so two runs on the same machine can be compared. Change
+	Benchmark_BotsPerTeam for more or less load.
+ */
+
+static team_a;
+static team_b;
+static player_a, player_b, bots;
+
+static const Benchmark_BotsPerTeam = 8;
+static const Benchmark_PhaseFrames = 350;
+static const Benchmark_BotSpacing = 20;
+
+
+func Initialize()
+{
+	Arena_FactionManager->SetType(Arena_Faction_Team);
+
+	team_a = Arena_FactionManager->GetInstance()->GetFaction(1);
+	team_b = Arena_FactionManager->GetInstance()->GetFaction(2);
+
+	// Create script players for these tests.
+	CreateScriptPlayer("Team A", RGB(0, 0, 255), team_a->GetID(), CSPF_NoEliminationCheck);
+	CreateScriptPlayer("Team B", RGB(255, 0, 0), team_b->GetID(), CSPF_NoEliminationCheck);
+}
+
+
+func InitializePlayer(int player)
+{
+	// Initialize script player.
+	if (GetPlayerType(player) == C4PT_Script)
+	{
+		// Store the player numbers.
+		if (GetPlayerName(player) == "Team A")
+		{
+			player_a = player;
+		}
+		else if (GetPlayerName(player) == "Team B")
+		{
+			player_b = player;
+		}
+		return;
+	}
+
+	// Set zoom to full map size.
+	SetPlayerZoomByViewRange(player, LandscapeWidth(), nil, PLRZOOM_Direct);
+
+	// No FoW to see everything happening.
+	SetFoW(false, player);
+
+	// Move normal players into a relaunch container.
+	var relaunch = CreateObject(RelaunchContainer, LandscapeWidth() / 2, LandscapeHeight() / 2);
+	GetCrew(player)->Enter(relaunch);
+
+	LaunchTest(1);
+	return true;
+}
+
+/* --- Some helper things --- */
+
+global func GetPlayerName(int player)
+{
+	if (player == NO_OWNER)
+		return "NO_OWNER";
+	return _inherited(player, ...);
+}
+
+
+global func GetGroundY()
+{
+	return 40 * LandscapeHeight() / 50;
+}
+
+
+/**
+	Starts a phase: removes everything from the previous phase
+	and creates the bots of both teams.
+
+	@par phase {Name, Class, Weapon, Grenades, Distance, Flag}
+ */
+global func InitPhase(proplist phase)
+{
+	// Remove all objects except the player crew members and relaunch container they are in.
+	for (var obj in FindObjects(Find_Not(Find_Or(Find_ID(Arena_FactionManager), Find_ID(RelaunchContainer), Find_Category(C4D_Rule)))))
+		if (obj && !((obj->GetOCF() & OCF_CrewMember) && (GetPlayerType(obj->GetOwner()) == C4PT_User)))
+			obj->RemoveObject();
+
+	if (phase.Flag)
+	{
+		CreateObject(CMC_FlagPost, LandscapeWidth() / 2, GetGroundY(), NO_OWNER);
+	}
+
+	bots = [];
+	for (var player in [player_a, player_b])
+	{
+		var side = -1;
+		if (player == player_b) side = +1;
+
+		for (var i = 0; i < Benchmark_BotsPerTeam; ++i)
+		{
+			var x = LandscapeWidth() / 2 + side * (phase.Distance / 2 + i * Benchmark_BotSpacing);
+			var bot = CreateObjectAbove(Peacemaker, x, GetGroundY() - 1, player);
+			bot->MakeCrewMember(player);
+			bot->SetDir(DIR_Right);
+			if (side > 0) bot->SetDir(DIR_Left);
+			bot->SetCrewClass(phase.Class);
+			bot->OnCrewRelaunchFinish();
+			bot.benchmark_index = i;
+			bot.benchmark_side = side;
+			PushBack(bots, bot);
+		}
+	}
+
+	var test = CurrentTest();
+	test.phase = phase;
+	test.frame = 0;
+	test.script_time = 0;
+	test.start_time = GetTime();
+	ResetParticleCounters();
+	return true;
+}
+
+
+global func RunPhase()
+{
+	var test = CurrentTest();
+	var phase = test.phase;
+	if (test.frame < Benchmark_PhaseFrames)
+	{
+		var start_time = GetTime();
+		for (var bot in bots)
+		{
+			if (bot && bot->GetAlive())
+			{
+				DriveBot(bot, phase, test.frame);
+			}
+		}
+		test.script_time += GetTime() - start_time;
+		test.frame += 1;
+		return Wait(1);
+	}
+
+	var particles = GetParticleCounters();
+	Log("[Benchmark] CombatLoad;phase=%s;bots=%d;frames=%d;objects=%d;particles=%d;requested_particles=%d;time_ms=%d;script_ms=%d",
+	    phase.Name, 2 * Benchmark_BotsPerTeam, test.frame, ObjectCount(),
+	    particles.emitted, particles.requested,
+	    GetTime() - test.start_time, test.script_time);
+	LogParticleCounters();
+	return PassTest();
+}
+
+
+// Every bot acts in a cycle of 35 frames, shifted by its index
+global func DriveBot(object bot, proplist phase, int frame)
+{
+	var cycle = (frame + 5 * bot.benchmark_index) % 35;
+	var aim_x = -100 * bot.benchmark_side;
+	var aim_y = -10 - 2 * bot.benchmark_index;
+
+	// Keep the bots in the fight
+	if (cycle == 0)
+	{
+		bot->DoEnergy(bot.MaxEnergy / 1000);
+		if (phase.Flag && frame % 105 == 0)
+		{
+			var x = LandscapeWidth() / 2 + bot.benchmark_side * (20 + bot.benchmark_index * 5);
+			bot->SetCommand("MoveTo", nil, x, GetGroundY() - 10);
+		}
+	}
+
+	if (phase.Weapon)
+	{
+		var weapon = bot->FindContents(phase.Weapon);
+		if (weapon)
+		{
+			DriveBotWeapon(bot, weapon, cycle, aim_x, aim_y);
+		}
+	}
+
+	// Throw a grenade in every cycle, alternating between the types
+	if (phase.Grenades && cycle == 10)
+	{
+		var type = phase.Grenades[(frame / 35 + bot.benchmark_index) % GetLength(phase.Grenades)];
+		bot->DoGrenadeCount(type, 1);
+		if (bot->TakeGrenade(type))
+		{
+			var grenade = bot->FindContents(type);
+			grenade->ControlUseStart(bot, aim_x, 3 * aim_y);
+			grenade->ControlUseStop(bot, aim_x, 3 * aim_y);
+		}
+	}
+}
+
+
+// Fires for 20 frames per cycle; Missiles are fired with a single shot
+global func DriveBotWeapon(object bot, object weapon, int cycle, int aim_x, int aim_y)
+{
+	var ammo = weapon->GetFiremode()->GetAmmoID();
+	if (cycle == 0 && weapon->GetAmmo(ammo) < 10)
+	{
+		weapon->DoAmmo(ammo, 30);
+	}
+
+	if (weapon->GetID() == CMC_Weapon_RocketLauncher)
+	{
+		if (cycle == 0) weapon->ControlUseAltStart(bot, aim_x, aim_y);
+		if (cycle == 1) weapon->ControlUseAltHolding(bot, aim_x, aim_y);
+		if (cycle == 2) weapon->ControlUseAltStop(bot, aim_x, aim_y);
+		if (cycle == 20) weapon->ControlUseStart(bot, aim_x, aim_y);
+		if (cycle == 21) weapon->ControlUseHolding(bot, aim_x, aim_y);
+		if (cycle == 22) weapon->ControlUseStop(bot, aim_x, aim_y);
+	}
+	else
+	{
+		if (cycle == 0) weapon->ControlUseStart(bot, aim_x, aim_y);
+		if (cycle > 0 && cycle < 20) weapon->ControlUseHolding(bot, aim_x, aim_y);
+		if (cycle == 20) weapon->ControlUseStop(bot, aim_x, aim_y);
+	}
+}
+
+/* --- Tests --- */
+
+//--------------------------------------------------------
+
+global func Test1_OnStart(int player)
+{
+	Log("Full-auto rifle duel");
+	return InitPhase({Name = "RifleDuel", Class = CMC_Class_Assault, Weapon = CMC_Weapon_AssaultRifle, Distance = 400});
+}
+global func Test1_OnFinished(){ return; }
+global func Test1_Execute(){ return RunPhase(); }
+
+//--------------------------------------------------------
+
+global func Test2_OnStart(int player)
+{
+	Log("Shotgun close combat");
+	return InitPhase({Name = "ShotgunClose", Class = CMC_Class_AntiSkill, Weapon = CMC_Weapon_Shotgun, Distance = 40});
+}
+global func Test2_OnFinished(){ return; }
+global func Test2_Execute(){ return RunPhase(); }
+
+//--------------------------------------------------------
+
+global func Test3_OnStart(int player)
+{
+	Log("Grenade spam");
+	return InitPhase({Name = "GrenadeSpam", Class = CMC_Class_Artillery, Grenades = [CMC_Grenade_Field, CMC_Grenade_Frag], Distance = 300});
+}
+global func Test3_OnFinished(){ return; }
+global func Test3_Execute(){ return RunPhase(); }
+
+//--------------------------------------------------------
+
+global func Test4_OnStart(int player)
+{
+	Log("Smoke and phosphor");
+	return InitPhase({Name = "SmokePhosphor", Class = CMC_Class_AntiSkill, Grenades = [CMC_Grenade_Smoke, CMC_Grenade_Phosphor], Distance = 300});
+}
+global func Test4_OnFinished(){ return; }
+global func Test4_Execute(){ return RunPhase(); }
+
+//--------------------------------------------------------
+
+global func Test5_OnStart(int player)
+{
+	Log("Missile barrage");
+	return InitPhase({Name = "MissileBarrage", Class = CMC_Class_Support, Weapon = CMC_Weapon_RocketLauncher, Distance = 600});
+}
+global func Test5_OnFinished(){ return; }
+global func Test5_Execute(){ return RunPhase(); }
+
+//--------------------------------------------------------
+
+global func Test6_OnStart(int player)
+{
+	Log("Flag fight");
+	return InitPhase({Name = "FlagFight", Class = CMC_Class_Assault, Weapon = CMC_Weapon_AssaultRifle, Distance = 300, Flag = true});
+}
+global func Test6_OnFinished(){ return; }
+global func Test6_Execute(){ return RunPhase(); }
@@ -0,0 +1,10 @@
+/**
+	Flat battlefield for the flag post benchmark.
+ */
+
+func InitializeMap(proplist map)
+{
+	map->Resize(200, 40);
+	map->Draw("Brick", nil, [0, 35, 200, 5]);
+	return true;
+}
@@ -0,0 +1,214 @@
+/**
+	Benchmark for the flag post manager
+
+	Runs the same fight over 10 flag posts with 24 crew members twice:
+	First with every flag post running its own capture timer,
+	then with all flag posts being evaluated by CMC_FlagPostManager.
+ */
+
+static team_a;
+static team_b;
+static player_a, player_b, flags, crew;
+
+static const Benchmark_FlagCount = 10;
+static const Benchmark_CrewPerTeam = 12;
+static const Benchmark_Steps = 30;
+static const Benchmark_StepFrames = 35;
+
+
+func Initialize()
+{
+	Arena_FactionManager->SetType(Arena_Faction_Team);
+
+	team_a = Arena_FactionManager->GetInstance()->GetFaction(1);
+	team_b = Arena_FactionManager->GetInstance()->GetFaction(2);
+
+	// Create script players for these tests.
+	CreateScriptPlayer("Team A", RGB(0, 0, 255), team_a->GetID(), CSPF_NoEliminationCheck);
+	CreateScriptPlayer("Team B", RGB(255, 0, 0), team_b->GetID(), CSPF_NoEliminationCheck);
+}
+
+
+func InitializePlayer(int player)
+{
+	// Initialize script player.
+	if (GetPlayerType(player) == C4PT_Script)
+	{
+		// Store the player numbers.
+		if (GetPlayerName(player) == "Team A")
+		{
+			player_a = player;
+		}
+		else if (GetPlayerName(player) == "Team B")
+		{
+			player_b = player;
+		}
+		return;
+	}
+
+	// Set zoom to full map size.
+	SetPlayerZoomByViewRange(player, LandscapeWidth(), nil, PLRZOOM_Direct);
+
+	// No FoW to see everything happening.
+	SetFoW(false, player);
+
+	// Move normal players into a relaunch container.
+	var relaunch = CreateObject(RelaunchContainer, LandscapeWidth() / 2, LandscapeHeight() / 2);
+	GetCrew(player)->Enter(relaunch);
+
+	LaunchTest(1);
+	return true;
+}
+
+/* --- Some helper things --- */
+
+global func GetPlayerName(int player)
+{
+	if (player == NO_OWNER)
+		return "NO_OWNER";
+	return _inherited(player, ...);
+}
+
+
+global func InitBenchmark(bool use_manager)
+{
+	// Remove all objects except the player crew members and relaunch container they are in.
+	for (var obj in FindObjects(Find_Not(Find_Or(Find_ID(Arena_FactionManager), Find_ID(RelaunchContainer), Find_Category(C4D_Rule)))))
+		if (obj && !((obj->GetOCF() & OCF_CrewMember) && (GetPlayerType(obj->GetOwner()) == C4PT_User)))
+			obj->RemoveObject();
+
+	CMC_FlagPostManager->SetEnabled(use_manager);
+
+	// Flag posts
+	flags = [];
+	for (var i = 0; i < Benchmark_FlagCount; ++i)
+	{
+		flags[i] = CreateObject(CMC_FlagPost, GetFlagX(i), 280, NO_OWNER);
+		flags[i]->SetName(Format("Flag %d", i));
+	}
+
+	// Crew members, distributed so that some flags are contested and others are not
+	crew = [];
+	for (var player in [player_a, player_b])
+	{
+		crew[player] = [];
+		for (var i = 0; i < Benchmark_CrewPerTeam; ++i)
+		{
+			var clonk = CreateObjectAbove(Peacemaker, GetFlagX(GetStartFlag(player, i)), 270, player);
+			clonk->MakeCrewMember(player);
+			clonk->MakeInvincible(true);
+			crew[player][i] = clonk;
+		}
+	}
+	return true;
+}
+
+
+global func GetFlagX(int index)
+{
+	return 100 + 150 * index;
+}
+
+
+global func GetStartFlag(int player, int index)
+{
+	if (player == player_a)
+	{
+		return index % Benchmark_FlagCount;
+	}
+	return (3 * index + 1) % Benchmark_FlagCount;
+}
+
+
+global func MoveBenchmarkCrew(int step)
+{
+	// Every few steps each crew member walks to the next flag
+	for (var player in [player_a, player_b])
+	{
+		for (var i = 0; i < Benchmark_CrewPerTeam; ++i)
+		{
+			var clonk = crew[player][i];
+			if (clonk && (step + i) % 5 == 0)
+			{
+				var target = (GetStartFlag(player, i) + step / 5) % Benchmark_FlagCount;
+				clonk->SetCommand("MoveTo", nil, GetFlagX(target), 270);
+			}
+		}
+	}
+}
+
+
+global func RunBenchmark(string mode)
+{
+	var test = CurrentTest();
+	if (test.step == nil)
+	{
+		test.step = 0;
+		test.start_time = GetTime();
+		test.start_frame = FrameCounter();
+	}
+
+	if (test.step < Benchmark_Steps)
+	{
+		MoveBenchmarkCrew(test.step);
+		test.step += 1;
+		return Wait(Benchmark_StepFrames);
+	}
+
+	var frames = FrameCounter() - test.start_frame;
+	var time = GetTime() - test.start_time;
+	var captured = 0;
+	for (var flag in flags)
+	{
+		if (flag->IsFullyCaptured()) captured += 1;
+	}
+	Log("[Benchmark] FlagPosts;mode=%s;flags=%d;crew=%d;frames=%d;time_ms=%d;captured=%d", mode, Benchmark_FlagCount, 2 * Benchmark_CrewPerTeam, frames, time, captured);
+	test.step = nil;
+	return PassTest();
+}
+
+/* --- Tests --- */
+
+//--------------------------------------------------------
+
+global func Test1_OnStart(int player)
+{
+	Log("Flag posts with their own capture timers");
+	return InitBenchmark(false);
+}
+global func Test1_OnFinished(){ return; }
+global func Test1_Execute()
+{
+	return RunBenchmark("timers");
+}
+
+//--------------------------------------------------------
+
+global func Test2_OnStart(int player)
+{
+	Log("Flag posts evaluated by the flag post manager");
+	return InitBenchmark(true);
+}
+global func Test2_OnFinished(){ return; }
+global func Test2_Execute()
+{
+	var result = RunBenchmark("manager");
+	if (CurrentTest().step == nil)
+	{
+		doTest("Manager counts %d flag posts for team A, expected %d", CMC_FlagPostManager->GetControlledFlagPostCount(team_a), CountCapturedFlags(team_a));
+		doTest("Manager counts %d flag posts for team B, expected %d", CMC_FlagPostManager->GetControlledFlagPostCount(team_b), CountCapturedFlags(team_b));
+		return Evaluate();
+	}
+	return result;
+}
+
+
+global func CountCapturedFlags(proplist faction)
+{
+	var count = 0;
+	for (var flag in flags)
+	{
+		if (flag->IsFullyCaptured() && flag->GetTeam() == faction) count += 1;
+	}
+	return count;
+}
@@ -0,0 +1,10 @@
+/**
+	Flat ground for the mortal wounds benchmark.
+ */
+
+func InitializeMap(proplist map)
+{
+	map->Resize(64, 40);
+	map->Draw("Brick", nil, [0, 20, 64, 20]);
+	return true;
+}
@@ -0,0 +1,150 @@
+/**
+	Benchmark for the mortal wounds overrides
+
+	Searches 32 clonks with Find_Func("GetAlive"), once with delayed death
+	enabled (the clonk functions are overridden by CMC_Rule_MortalWounds),
+	once with some of the clonks being incapacitated, and once with
+	delayed death disabled.
+ */
+
+static player_crew;
+
+static const Benchmark_CrewCount = 32;
+static const Benchmark_Searches = 2000;
+
+
+func Initialize()
+{
+	// Create script players for these tests.
+	CreateScriptPlayer("Crew", RGB(0, 0, 255), nil, CSPF_NoEliminationCheck);
+}
+
+
+func InitializePlayer(int player)
+{
+	// Initialize script player.
+	if (GetPlayerType(player) == C4PT_Script)
+	{
+		// Store the player numbers.
+		if (GetPlayerName(player) == "Crew")
+		{
+			player_crew = player;
+		}
+		return;
+	}
+
+	// Set zoom to full map size.
+	SetPlayerZoomByViewRange(player, LandscapeWidth(), nil, PLRZOOM_Direct);
+
+	// No FoW to see everything happening.
+	SetFoW(false, player);
+
+	// Move normal players into a relaunch container.
+	var relaunch = CreateObject(RelaunchContainer, LandscapeWidth() / 2, LandscapeHeight() / 2);
+	GetCrew(player)->Enter(relaunch);
+
+	// The searches do not wait for frames
+	SetTestBatchMode(true);
+	LaunchTest(1);
+	return true;
+}
+
+/* --- Some helper things --- */
+
+global func GetPlayerName(int player)
+{
+	if (player == NO_OWNER)
+		return "NO_OWNER";
+	return _inherited(player, ...);
+}
+
+
+global func InitBenchmark(bool delayed_death)
+{
+	// Remove all objects except the player crew members and relaunch container they are in.
+	for (var obj in FindObjects(Find_Not(Find_ID(RelaunchContainer))))
+		if (obj && !((obj->GetOCF() & OCF_CrewMember) && (GetPlayerType(obj->GetOwner()) == C4PT_User)))
+			obj->RemoveObject();
+
+	// The rule object disables delayed death for crew that is recruited afterwards
+	if (!delayed_death)
+	{
+		CreateObject(CMC_Rule_MortalWounds);
+	}
+
+	for (var i = 0; i < Benchmark_CrewCount; ++i)
+	{
+		var clonk = CreateObjectAbove(Peacemaker, 20 + 15 * i, 150, player_crew);
+		clonk->MakeCrewMember(player_crew);
+	}
+	return true;
+}
+
+
+global func RunBenchmark(string mode)
+{
+	var found;
+	var start_time = GetTime();
+	for (var i = 0; i < Benchmark_Searches; ++i)
+	{
+		found = FindObjects(Find_Owner(player_crew), Find_Func("GetAlive"));
+	}
+	var time = GetTime() - start_time;
+	Log("[Benchmark] MortalWounds;mode=%s;crew=%d;searches=%d;time_ms=%d;found=%d", mode, Benchmark_CrewCount, Benchmark_Searches, time, GetLength(found));
+	return GetLength(found);
+}
+
+/* --- Tests --- */
+
+//--------------------------------------------------------
+
+global func Test1_OnStart(int player)
+{
+	Log("Find_Func(\"GetAlive\") with delayed death");
+	return InitBenchmark(true);
+}
+global func Test1_OnFinished(){ return; }
+global func Test1_Execute()
+{
+	doTest("Found %d alive clonks, expected %d", RunBenchmark("delayed_death"), Benchmark_CrewCount);
+	return Evaluate();
+}
+
+//--------------------------------------------------------
+
+global func Test2_OnStart(int player)
+{
+	Log("Find_Func(\"GetAlive\") with delayed death, half of the clonks are incapacitated");
+	InitBenchmark(true);
+	for (var i = 0; i < Benchmark_CrewCount / 2; ++i)
+	{
+		var clonk = GetCrew(player_crew, i);
+		clonk->DoEnergy(-clonk.MaxEnergy / 1000);
+	}
+	return true;
+}
+global func Test2_OnFinished(){ return; }
+global func Test2_Execute()
+{
+	doTest("Found %d alive clonks, expected %d", RunBenchmark("incapacitated"), Benchmark_CrewCount - Benchmark_CrewCount / 2);
+	return Evaluate();
+}
+
+//--------------------------------------------------------
+
+global func Test3_OnStart(int player)
+{
+	Log("Find_Func(\"GetAlive\") without delayed death");
+	return InitBenchmark(false);
+}
+global func Test3_OnFinished()
+{
+	if (CMC_Rule_MortalWounds->GetInstance())
+		CMC_Rule_MortalWounds->GetInstance()->RemoveObject();
+	return;
+}
+global func Test3_Execute()
+{
+	doTest("Found %d alive clonks, expected %d", RunBenchmark("instant_death"), Benchmark_CrewCount);
+	return Evaluate();
+}
@@ -0,0 +1,208 @@
+/**
+	Benchmark for the loadout of a relaunch
+
+	Hands out the equipment of every class to a group of crew members. This is
+	done once item by item, like the class system did before the loadout
+	templates, and once from the template of the class.
+
+	The crew members belong to a script player, so that they have a HUD
+	controller that receives the inventory, slot and ammo notifications.
+ */
+
+static player_crew;
+static loadouts_by_item;
+
+static const Benchmark_Rounds = 10;
+static const Benchmark_CrewCount = 8;
+
+
+func Initialize()
+{
+	// Create script players for these tests.
+	CreateScriptPlayer("Crew", RGB(0, 0, 255), nil, CSPF_NoEliminationCheck);
+}
+
+
+func InitializePlayer(int player)
+{
+	// Initialize script player.
+	if (GetPlayerType(player) == C4PT_Script)
+	{
+		// Store the player numbers.
+		if (GetPlayerName(player) == "Crew")
+		{
+			player_crew = player;
+		}
+		return;
+	}
+
+	// Set zoom to full map size.
+	SetPlayerZoomByViewRange(player, LandscapeWidth(), nil, PLRZOOM_Direct);
+
+	// No FoW to see everything happening.
+	SetFoW(false, player);
+
+	// Move normal players into a relaunch container.
+	var relaunch = CreateObject(RelaunchContainer, LandscapeWidth() / 2, LandscapeHeight() / 2);
+	GetCrew(player)->Enter(relaunch);
+
+	LaunchTest(1);
+	return true;
+}
+
+/* --- Some helper things --- */
+
+global func InitBenchmark()
+{
+	// Remove all objects except the player crew members and relaunch container they are in.
+	for (var obj in FindObjects(Find_Not(Find_ID(RelaunchContainer))))
+		if (obj && !((obj->GetOCF() & OCF_CrewMember) && (GetPlayerType(obj->GetOwner()) == C4PT_User)))
+			obj->RemoveObject();
+
+	CurrentTest().class_index = nil;
+	return true;
+}
+
+
+// Crew members that are about to be relaunched
+global func CreateBenchmarkCrew(id class)
+{
+	var crew = [];
+	var ground = LandscapeHeight() / 2;
+	for (var i = 0; i < Benchmark_CrewCount; ++i)
+	{
+		var clonk = CreateObjectAbove(Peacemaker, LandscapeWidth() / 2 + (i - Benchmark_CrewCount / 2) * 8, ground - 1, player_crew);
+		clonk->MakeCrewMember(player_crew);
+		clonk->SetCrewClass(class);
+		PushBack(crew, clonk);
+	}
+	return crew;
+}
+
+
+// The equipment, item by item, as the class system did before
+global func CreateLoadoutItemByItem(object crew)
+{
+	var class = crew->GetCrewClass();
+	for (var ammo_type in GetProperties(class.Ammo))
+	{
+		crew->SetAmmo(GetDefinition(ammo_type), class.Ammo[ammo_type]);
+	}
+	for (var item_type in GetProperties(class.Items))
+	{
+		crew->CreateContents(class.Items[item_type].Type, class.Items[item_type].Amount);
+	}
+	for (var grenade_type in GetProperties(class.Grenades))
+	{
+		crew->~DoGrenadeCount(grenade_type, class.Grenades[grenade_type]);
+	}
+	crew->~GetCurrentGrenadeType();
+}
+
+
+// The equipment that a crew member actually has
+global func GetBenchmarkLoadout(object crew)
+{
+	var class = crew->GetCrewClass();
+	var loadout = {Items = [], Ammo = [], Grenades = []};
+	for (var i = 0; i < crew->ContentsCount(); ++i)
+	{
+		PushBack(loadout.Items, crew->Contents(i)->GetID());
+	}
+	for (var ammo_type in GetProperties(class.Ammo))
+	{
+		PushBack(loadout.Ammo, [GetDefinition(ammo_type), crew->GetAmmo(GetDefinition(ammo_type))]);
+	}
+	for (var grenade_type in GetProperties(class.Grenades))
+	{
+		PushBack(loadout.Grenades, [GetDefinition(grenade_type), crew->~GetGrenadeCount(GetDefinition(grenade_type))]);
+	}
+	return loadout;
+}
+
+
+global func RunBenchmark(string mode)
+{
+	var test = CurrentTest();
+	if (test.class_index == nil)
+	{
+		test.class_index = 0;
+		test.loadouts = [];
+	}
+
+	var classes = Peacemaker->GetAvailableClasses();
+	if (test.class_index < GetLength(classes))
+	{
+		var class = classes[test.class_index];
+		var time = 0;
+		var loadout = nil;
+		for (var round = 0; round < Benchmark_Rounds; ++round)
+		{
+			var crew = CreateBenchmarkCrew(class);
+			var start_time = GetTime();
+			for (var clonk in crew)
+			{
+				if (mode == "template")
+				{
+					clonk->MaterializeCrewLoadout(class->GetClassLoadout());
+				}
+				else
+				{
+					CreateLoadoutItemByItem(clonk);
+				}
+			}
+			time += GetTime() - start_time;
+			loadout = GetBenchmarkLoadout(crew[0]);
+			for (var clonk in crew)
+			{
+				clonk->RemoveObject();
+			}
+		}
+		Log("[Benchmark] RelaunchLoadout;mode=%s;class=%i;crew=%d;rounds=%d;items=%d;time_ms=%d",
+		    mode, class, Benchmark_CrewCount, Benchmark_Rounds, GetLength(loadout.Items), time);
+		PushBack(test.loadouts, loadout);
+		test.class_index += 1;
+		return Wait(1);
+	}
+	return true;
+}
+
+/* --- Tests --- */
+
+//--------------------------------------------------------
+
+global func Test1_OnStart(int player)
+{
+	Log("Loadout item by item");
+	return InitBenchmark();
+}
+global func Test1_OnFinished(){ return; }
+global func Test1_Execute()
+{
+	var done = RunBenchmark("item_by_item");
+	if (done != true) return done;
+
+	loadouts_by_item = CurrentTest().loadouts;
+	return PassTest();
+}
+
+//--------------------------------------------------------
+
+global func Test2_OnStart(int player)
+{
+	Log("Loadout from the class template");
+	return InitBenchmark();
+}
+global func Test2_OnFinished(){ return; }
+global func Test2_Execute()
+{
+	var done = RunBenchmark("template");
+	if (done != true) return done;
+
+	var classes = Peacemaker->GetAvailableClasses();
+	for (var i = 0; i < GetLength(classes); ++i)
+	{
+		doTest(Format("%i gets the same loadout: %s, expected %s", classes[i], "%v", "%v"), CurrentTest().loadouts[i], loadouts_by_item[i]);
+	}
+	return Evaluate();
+}
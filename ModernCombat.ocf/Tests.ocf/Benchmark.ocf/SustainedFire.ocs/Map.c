@@ -0,0 +1,11 @@
+/**
+	Earth and brick ground for the sustained fire benchmark.
+ */
+
+func InitializeMap(proplist map)
+{
+	map->Resize(64, 40);
+	map->Draw("Earth", nil, [0, 20, 32, 20]);
+	map->Draw("Brick", nil, [32, 20, 32, 20]);
+	return true;
+}
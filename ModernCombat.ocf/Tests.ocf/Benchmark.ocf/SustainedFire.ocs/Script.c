@@ -0,0 +1,139 @@
+/**
+	Benchmark for the particle definition cache
+
+	Simulates sustained fire by letting bullets hit earth and brick
+	many times, once with the particle definition cache disabled and
+	once with the cache enabled. Every hit creates dust, debris, sparks
+	and a bullet trace.
+ */
+
+static const Benchmark_HitsPerFrame = 50;
+static const Benchmark_Frames = 40;
+
+
+func InitializePlayer(int player)
+{
+	// Set zoom to full map size.
+	SetPlayerZoomByViewRange(player, LandscapeWidth(), nil, PLRZOOM_Direct);
+
+	// No FoW to see everything happening.
+	SetFoW(false, player);
+
+	// Move normal players into a relaunch container.
+	var relaunch = CreateObject(RelaunchContainer, LandscapeWidth() / 2, LandscapeHeight() / 2);
+	GetCrew(player)->Enter(relaunch);
+
+	LaunchTest(1);
+	return true;
+}
+
+/* --- Some helper things --- */
+
+global func InitBenchmark(bool use_cache)
+{
+	// Remove all objects except the player crew members and relaunch container they are in.
+	for (var obj in FindObjects(Find_Not(Find_ID(RelaunchContainer))))
+		if (obj && !((obj->GetOCF() & OCF_CrewMember) && (GetPlayerType(obj->GetOwner()) == C4PT_User)))
+			obj->RemoveObject();
+
+	SetParticleDefinitionCache(use_cache);
+
+	// One bullet on earth and one on brick, directly above the ground
+	var ground = LandscapeHeight() / 2;
+	CurrentTest().bullets = [];
+	for (var x in [LandscapeWidth() / 4, 3 * LandscapeWidth() / 4])
+	{
+		var bullet = CreateObject(CMC_Projectile_Bullet, x, ground - 2, NO_OWNER);
+		bullet.velocity = 200;
+		bullet.MaterialProperties = bullet->GetMaterialProperties(0, 3);
+		bullet.benchmark_x = x;
+		bullet.benchmark_y = ground - 2;
+		PushBack(CurrentTest().bullets, bullet);
+	}
+	return true;
+}
+
+
+global func RunBenchmark(string mode)
+{
+	var test = CurrentTest();
+	if (test.frame == nil)
+	{
+		test.frame = 0;
+		test.time = 0;
+		test.counters = GetParticleDefinitionCounters();
+	}
+
+	if (test.frame < Benchmark_Frames)
+	{
+		// The bullets are not launched, so keep them in place
+		for (var bullet in test.bullets)
+		{
+			bullet->SetPosition(bullet.benchmark_x, bullet.benchmark_y);
+			bullet->SetXDir(50);
+			bullet->SetYDir(100);
+		}
+
+		var start_time = GetTime();
+		for (var i = 0; i < Benchmark_HitsPerFrame; ++i)
+		{
+			for (var bullet in test.bullets)
+			{
+				bullet->OnHitLandscape();
+				bullet->DrawTrace(bullet->GetX() - 200, bullet->GetY() - 100, bullet->GetX(), bullet->GetY());
+			}
+		}
+		test.time += GetTime() - start_time;
+		test.frame += 1;
+		return Wait(1);
+	}
+
+	var counters = GetParticleDefinitionCounters();
+	test.built = counters.built - test.counters.built;
+	test.reused = counters.reused - test.counters.reused;
+	Log("[Benchmark] SustainedFire;mode=%s;hits=%d;time_ms=%d;definitions_built=%d;definitions_reused=%d", mode, Benchmark_HitsPerFrame * Benchmark_Frames * GetLength(test.bullets), test.time, test.built, test.reused);
+	test.frame = nil;
+	return PassTest();
+}
+
+/* --- Tests --- */
+
+//--------------------------------------------------------
+
+global func Test1_OnStart(int player)
+{
+	Log("Sustained fire without particle definition cache");
+	return InitBenchmark(false);
+}
+global func Test1_OnFinished(){ return; }
+global func Test1_Execute()
+{
+	var result = RunBenchmark("no_cache");
+	if (CurrentTest().frame == nil)
+	{
+		doTest("Reused %d particle definitions, expected %d", CurrentTest().reused, 0);
+		return Evaluate();
+	}
+	return result;
+}
+
+//--------------------------------------------------------
+
+global func Test2_OnStart(int player)
+{
+	Log("Sustained fire with particle definition cache");
+	return InitBenchmark(true);
+}
+global func Test2_OnFinished(){ return; }
+global func Test2_Execute()
+{
+	var result = RunBenchmark("cache");
+	if (CurrentTest().frame == nil)
+	{
+		// Each bullet needs its dust, debris, glimmer, spark and trace definitions only once
+		doTest("Built few particle definitions: %v, expected %v", CurrentTest().built <= 10, true);
+		doTest("Reused particle definitions: %v, expected %v", CurrentTest().reused > 0, true);
+		return Evaluate();
+	}
+	return result;
+}
@@ -57,6 +57,8 @@ func InitializePlayer(int player)
 	var relaunch = CreateObject(RelaunchContainer, LandscapeWidth() / 2, LandscapeHeight() / 2);
 	GetCrew(player)->Enter(relaunch);
 
+	// Tests that finish right away do not wait for the next frame
+	SetTestBatchMode(true);
 	LaunchTest(1);
 	return true;
 }
@@ -161,3 +163,32 @@ global func Test2_Execute()
 		return Wait(30);
 	}
 }
+
+//--------------------------------------------------------
+
+global func Test3_OnStart(int player)
+{
+	Log("Team A captures the flag after the flag post manager was removed");
+	InitTest(1, 10);
+	RemoveAll(Find_ID(CMC_FlagPostManager));
+	for (var clonk in crew[team_a_p1])
+	{
+		clonk->SetPosition(flag->GetX(), flag->GetY() - 10);
+	}
+	return true;
+}
+global func Test3_OnFinished(){ return; }
+global func Test3_Execute()
+{
+	if (goal->IsFulfilled())
+	{
+		doTest("Score for team A is %d, expected %d", goal->GetFactionScore(team_a), 1);
+		doTest("Score for team B is %d, expected %d", goal->GetFactionScore(team_b), 0);
+		doTest("Manager counts %d flag posts for team A, expected %d", CMC_FlagPostManager->GetControlledFlagPostCount(team_a), 1);
+		return Evaluate();
+	}
+	else
+	{
+		return Wait(30);
+	}
+}
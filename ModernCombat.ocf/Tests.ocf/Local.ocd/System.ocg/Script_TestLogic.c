@@ -1,6 +1,12 @@
 
 /* --- Test Control --- */
 
+static const TestBatch_MaxSteps = 100; // Most test steps per frame in batch mode
+
+static test_batch_mode;   // Steps that do not wait are executed in the same frame, see SetTestBatchMode()
+static test_current_run;  // The control effect whose test is executed right now, see CurrentTest()
+static test_suite;        // Counters and results of all control effects, see GetTestSuite()
+
 // Aborts the current test and launches the specified test instead.
 global func LaunchTest(int nr)
 {
@@ -18,16 +24,76 @@ global func LaunchTest(int nr)
 		// Create a new control effect and launch the test.
 		test = Scenario->CreateEffect(IntTestControl, 100, 2);
 		test.player = GetPlayerByIndex(0, C4PT_User);
-		test.global_result = true;
-		test.count_total = 0;
-		test.count_failed = 0;
-		test.count_skipped = 0;
+		StartTestSuite();
 	}
 
 	test.testnr = nr;
 	test.launched = false;
 }
 
+
+/**
+	Runs the tests in parallel, one test per arena.
+	Use this only if the tests create their objects inside
+	GetTestArena() and do not remove objects of other arenas.
+
+	@par nr The first test.
+	@par arenas Array of {X, Y, Wdt, Hgt} rectangles in the landscape.
+ */
+global func LaunchTestsInArenas(int nr, array arenas)
+{
+	var suite = StartTestSuite();
+	suite.next_testnr = nr;
+	for (var arena in arenas)
+	{
+		var test = Scenario->CreateEffect(IntTestControl, 100, 2);
+		test.player = GetPlayerByIndex(0, C4PT_User);
+		test.arena = arena;
+		test.launched = false;
+		suite.active_runs += 1;
+	}
+}
+
+
+/**
+	Resets the counters and results of the tests.
+	The suite outlives the control effects, so that tests
+	in several arenas count into the same summary.
+ */
+global func StartTestSuite()
+{
+	test_suite =
+	{
+		global_result = true,
+		count_total = 0,
+		count_failed = 0,
+		count_skipped = 0,
+		results = [],
+		start_frame = FrameCounter(),
+		start_time = GetTime(),
+		active_runs = 0,
+	};
+	return test_suite;
+}
+
+
+global func GetTestSuite()
+{
+	return test_suite ?? StartTestSuite();
+}
+
+
+/**
+	Enables the batch mode: After a test finished, the next test
+	is launched in the same frame. Only Wait() and tests that
+	return false let game frames pass.
+ */
+global func SetTestBatchMode(bool enable)
+{
+	test_batch_mode = enable;
+}
+
+
 // Calling this function skips the current test, does not work if last test has been ran already.
 global func SkipTest()
 {
@@ -39,10 +105,26 @@ global func SkipTest()
 		Call(Format("~Test%d_OnFinished", test.testnr));
 		// Start the next test by just increasing the test number and setting 
 		// test.launched to false, effect will handle the rest.
-		test.testnr++;
+		test->AddResult("skipped");
+		if (!test.arena)
+		{
+			test.testnr++;
+		}
 		test.launched = false;
-		test.count_skipped++;
+		GetTestSuite().count_skipped++;
+	}
+}
+
+
+// Gets the area of the landscape that the current test may use.
+global func GetTestArena()
+{
+	var test = CurrentTest();
+	if (test && test.arena)
+	{
+		return test.arena;
 	}
+	return {X = 0, Y = 0, Wdt = LandscapeWidth(), Hgt = LandscapeHeight()};
 }
 
 
@@ -62,9 +144,37 @@ static const IntTestControl = new Effect
 
 	Timer = func ()
 	{
+		// In batch mode, steps that do not wait are executed back-to-back
+		for (var steps = 0; steps < TestBatch_MaxSteps; ++steps)
+		{
+			test_current_run = this;
+			var result = this->Step();
+			test_current_run = nil;
+
+			if (result == FX_Execute_Kill)
+			{
+				return FX_Execute_Kill;
+			}
+			if (!test_batch_mode || this.launched || this.wait > 0)
+			{
+				break;
+			}
+		}
+		return FX_OK;
+	},
+
+	Step = func ()
+	{
+		var suite = GetTestSuite();
+
 		// Launch new test if needed.
 		if (!this.launched)
 		{
+			// Tests in arenas take the next free test number
+			if (this.arena)
+			{
+				this.testnr = suite.next_testnr;
+			}
 			// Log test start.
 			Log("=====================================");
 			Log("Test %d started:", this.testnr);
@@ -72,24 +182,25 @@ static const IntTestControl = new Effect
 			if (!this->HasNextTest())
 			{
 				Log("Test %d not available, the previous test was the last test.", this.testnr);
-				Log("=====================================");
-				Log("All tests have been completed!");
-				Log("* %d tests total", this.count_total);
-				Log("%d tests failed", this.count_failed);
-				Log("%d tests skipped", this.count_skipped);
-				Log("=====================================");
-				if (this.count_skipped == 0 && this.count_failed == 0 && this.count_total > 0)
-				{
-					Log("All tests passed!");
-				}
-				else
+				if (this.arena)
 				{
-					Log("At least one test failed or was skipped!");
+					suite.active_runs -= 1;
+					if (suite.active_runs > 0)
+					{
+						return FX_Execute_Kill;
+					}
 				}
+				this->LogSummary(suite);
 				return FX_Execute_Kill;
 			}
+			if (this.arena)
+			{
+				suite.next_testnr = this.testnr + 1;
+			}
 			this.launched = true;
-			this.count_total++;
+			this.test_start_frame = FrameCounter();
+			this.test_start_time = GetTime();
+			suite.count_total++;
 			this.current_result = false;
 			this.current_check = true;
 		}
@@ -109,15 +220,17 @@ static const IntTestControl = new Effect
 			if (this.current_result)
 			{
 				Log(">> Test %d passed.", this.testnr);
+				this->AddResult("passed");
 			}
 			else
 			{
 				Log(">> Test %d failed.", this.testnr);
-				this.count_failed++;
+				this->AddResult("failed");
+				suite.count_failed++;
 			}
 
 			// Update global result
-			this.global_result &= this.current_result;
+			suite.global_result &= this.current_result;
 
 			// Call the test on finished function.
 			this->CleanupTest();
@@ -145,6 +258,45 @@ static const IntTestControl = new Effect
 	{
 		Call(Format("~Test%d_OnFinished", this.testnr));
 	},
+
+
+	AddResult = func (string result)
+	{
+		PushBack(GetTestSuite().results,
+		{
+			testnr = this.testnr,
+			name = Format("%s::Test%d", GetScenarioVal("Title", "Head"), this.testnr),
+			result = result,
+			frames = FrameCounter() - (this.test_start_frame ?? FrameCounter()),
+			time = GetTime() - (this.test_start_time ?? GetTime())
+		});
+	},
+
+
+	LogSummary = func (proplist suite)
+	{
+		Log("=====================================");
+		Log("All tests have been completed!");
+		Log("* %d tests total", suite.count_total);
+		Log("%d tests failed", suite.count_failed);
+		Log("%d tests skipped", suite.count_skipped);
+		Log("=====================================");
+		for (var result in suite.results ?? [])
+		{
+			Log("[TestResult] nr=%d;name=%s;result=%s;frames=%d;time_ms=%d", result.testnr, result.name, result.result, result.frames, result.time);
+		}
+		Log("[TestSummary] total=%d;failed=%d;skipped=%d;frames=%d;time_ms=%d", suite.count_total, suite.count_failed, suite.count_skipped,
+		    FrameCounter() - (suite.start_frame ?? 0), GetTime() - (suite.start_time ?? 0));
+		Log("=====================================");
+		if (suite.count_skipped == 0 && suite.count_failed == 0 && suite.count_total > 0)
+		{
+			Log("All tests passed!");
+		}
+		else
+		{
+			Log("At least one test failed or was skipped!");
+		}
+	},
 };
 
 
@@ -173,7 +325,7 @@ global func doTest(description, returned, expected)
 
 global func CurrentTest()
 {
-	return GetEffect("IntTestControl", Scenario);
+	return test_current_run ?? GetEffect("IntTestControl", Scenario);
 }
 
 global func Evaluate()
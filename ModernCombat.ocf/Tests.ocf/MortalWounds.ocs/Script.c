@@ -36,6 +36,8 @@ func InitializePlayer(int player)
 	var relaunch = CreateObject(RelaunchContainer, LandscapeWidth() / 2, LandscapeHeight() / 2);
 	GetCrew(player)->Enter(relaunch);
 
+	// Tests that finish right away do not wait for the next frame
+	SetTestBatchMode(true);
 	LaunchTest(1);
 	return true;
 }
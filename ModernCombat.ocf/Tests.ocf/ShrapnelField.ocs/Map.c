@@ -0,0 +1,10 @@
+/**
+	Flat brick ground for the shrapnel field test.
+ */
+
+func InitializeMap(proplist map)
+{
+	map->Resize(60, 30);
+	map->Draw("Brick", nil, [0, 20, 60, 10]);
+	return true;
+}
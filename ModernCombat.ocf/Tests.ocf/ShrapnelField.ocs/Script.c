@@ -0,0 +1,211 @@
+/**
+	Unit test for the shrapnel field
+
+	Launches the same fragments once with the shrapnel field and once as
+	shrapnel objects, and counts the hits on a row of dummy targets. The
+	fragments are created with the random seed of the scenario, so the
+	counts are the same in every run.
+ */
+
+static player_thrower;
+static player_dummies;
+static shrapnel_fragments;
+static shrapnel_hits_field;
+
+static const Test_FragmentCount = 40;
+static const Test_FragmentDamage = 20;
+static const Test_HitTolerance = 4;
+
+
+func Initialize()
+{
+	// Create script players for these tests.
+	CreateScriptPlayer("Thrower", RGB(0, 0, 255), nil, CSPF_NoEliminationCheck);
+	CreateScriptPlayer("Dummies", RGB(255, 0, 0), nil, CSPF_NoEliminationCheck);
+
+	// Fragments like the ones of a frag grenade on flat ground
+	shrapnel_fragments = [];
+	for (var i = 0; i < Test_FragmentCount; ++i)
+	{
+		PushBack(shrapnel_fragments, {Angle = RandomX(-90, +90), Speed = RandomX(70, 100)});
+	}
+}
+
+
+func InitializePlayer(int player)
+{
+	// Initialize script player.
+	if (GetPlayerType(player) == C4PT_Script)
+	{
+		// Store the player numbers.
+		if (GetPlayerName(player) == "Thrower")
+		{
+			player_thrower = player;
+		}
+		else if (GetPlayerName(player) == "Dummies")
+		{
+			player_dummies = player;
+		}
+		return;
+	}
+
+	// Set zoom to full map size.
+	SetPlayerZoomByViewRange(player, LandscapeWidth(), nil, PLRZOOM_Direct);
+
+	// No FoW to see everything happening.
+	SetFoW(false, player);
+
+	// Move normal players into a relaunch container.
+	var relaunch = CreateObject(RelaunchContainer, LandscapeWidth() / 2, LandscapeHeight() / 2);
+	GetCrew(player)->Enter(relaunch);
+
+	// Tests that finish right away do not wait for the next frame
+	SetTestBatchMode(true);
+	LaunchTest(1);
+	return true;
+}
+
+/* --- Some helper things --- */
+
+global func GetPlayerName(int player)
+{
+	if (player == NO_OWNER)
+		return "NO_OWNER";
+	return _inherited(player, ...);
+}
+
+
+global func GetGroundY()
+{
+	return 20 * LandscapeHeight() / 30;
+}
+
+
+global func InitTest()
+{
+	// Remove all objects except the player crew members and relaunch container they are in.
+	for (var obj in FindObjects(Find_Not(Find_Or(Find_ID(RelaunchContainer), Find_Category(C4D_Rule)))))
+		if (obj && !((obj->GetOCF() & OCF_CrewMember) && GetPlayerType(obj->GetOwner()) == C4PT_User))
+			obj->RemoveObject();
+
+	SetHostility(player_thrower, player_dummies, true, true);
+	SetHostility(player_dummies, player_thrower, true, true);
+
+	// Dummies on both sides, they survive all hits
+	for (var distance in [20, 40, 60, 80, 100, 120])
+	{
+		for (var side in [-1, +1])
+		{
+			var dummy = CreateObjectAbove(Peacemaker, LandscapeWidth() / 2 + side * distance, GetGroundY() - 1, player_dummies);
+			dummy->MakeCrewMember(player_dummies);
+			dummy.MaxEnergy = 1000 * Test_FragmentCount * Test_FragmentDamage * 2;
+			dummy->DoEnergy(dummy.MaxEnergy / 1000);
+			dummy.OnProjectileHit = Global.CountShrapnelHit;
+		}
+	}
+
+	CurrentTest().hits = 0;
+	CurrentTest().launched_frame = nil;
+	return true;
+}
+
+
+global func CountShrapnelHit(object projectile)
+{
+	CurrentTest().hits += 1;
+}
+
+
+// Any object with the controller of the thrower
+global func CreateShrapnelSource()
+{
+	var source = CreateObject(Rock, LandscapeWidth() / 2, GetGroundY() - 10, player_thrower);
+	source->SetController(player_thrower);
+	return source;
+}
+
+
+// Waits until no fragment is left
+global func WaitForFragments(bool field)
+{
+	var test = CurrentTest();
+	if (FrameCounter() > test.launched_frame + 5 * 35)
+	{
+		return FailTest();
+	}
+	if (field && FindObject(Find_ID(CMC_Effect_ShrapnelField), Find_AnyLayer()))
+	{
+		return Wait(5);
+	}
+	if (!field && FindObject(Find_ID(Shrapnel)))
+	{
+		return Wait(5);
+	}
+	return true;
+}
+
+/* --- Tests --- */
+
+//--------------------------------------------------------
+
+global func Test1_OnStart(int player){ return InitTest(); }
+global func Test1_OnFinished(){ return; }
+global func Test1_Execute()
+{
+	var test = CurrentTest();
+	if (test.launched_frame == nil)
+	{
+		Log("Shrapnel field hits the dummies");
+		var source = CreateShrapnelSource();
+		var field = CMC_Effect_ShrapnelField->Create(source, Test_FragmentDamage);
+		for (var fragment in shrapnel_fragments)
+		{
+			field->AddFragment(fragment.Angle, fragment.Speed);
+		}
+		source->RemoveObject();
+		test.launched_frame = FrameCounter();
+		doTest("Field has %d fragments, expected %d", field->GetFragmentCount(), Test_FragmentCount);
+		return Wait(1);
+	}
+
+	var done = WaitForFragments(true);
+	if (done != true) return done;
+
+	shrapnel_hits_field = test.hits;
+	Log("Fragments hit the dummies %d times", test.hits);
+	doTest("Field hit at least one dummy: %v, expected %v", test.hits > 0, true);
+	return Evaluate();
+}
+
+//--------------------------------------------------------
+
+global func Test2_OnStart(int player){ return InitTest(); }
+global func Test2_OnFinished(){ return; }
+global func Test2_Execute()
+{
+	var test = CurrentTest();
+	if (test.launched_frame == nil)
+	{
+		Log("Shrapnel objects hit the dummies as often as the shrapnel field");
+		var source = CreateShrapnelSource();
+		for (var fragment in shrapnel_fragments)
+		{
+			var shrapnel = source->CreateObject(Shrapnel, 0, 0, NO_OWNER);
+			shrapnel->SetVelocity(fragment.Angle, fragment.Speed);
+			shrapnel->Launch(player_thrower);
+			shrapnel.ProjectileDamage = Global.GetTestFragmentDamage;
+		}
+		source->RemoveObject();
+		test.launched_frame = FrameCounter();
+		return Wait(1);
+	}
+
+	var done = WaitForFragments(false);
+	if (done != true) return done;
+
+	Log("Fragments hit the dummies %d times, the field hit them %d times", test.hits, shrapnel_hits_field);
+	doTest(Format("Difference is within %d hits: %s, expected %s", Test_HitTolerance, "%v", "%v"), Abs(test.hits - shrapnel_hits_field) <= Test_HitTolerance, true);
+	return Evaluate();
+}
+
+global func GetTestFragmentDamage(){ return Test_FragmentDamage; }
@@ -0,0 +1,140 @@
+/**
+	Unit test for the test harness
+
+	Runs the tests in two arenas, in batch mode. Tests of the same round
+	start in the same frame, and every test keeps its objects in its arena.
+ */
+
+static harness_start_frames;
+
+static const Test_ArenaCount = 2;
+
+
+func Initialize()
+{
+	harness_start_frames = [];
+}
+
+
+func InitializePlayer(int player)
+{
+	// Set zoom to full map size.
+	SetPlayerZoomByViewRange(player, LandscapeWidth(), nil, PLRZOOM_Direct);
+
+	// No FoW to see everything happening.
+	SetFoW(false, player);
+
+	// Move normal players into a relaunch container.
+	var relaunch = CreateObject(RelaunchContainer, LandscapeWidth() / 2, LandscapeHeight() / 2);
+	GetCrew(player)->Enter(relaunch);
+
+	// Left and right half of the map
+	var width = LandscapeWidth() / Test_ArenaCount;
+	var arenas = [];
+	for (var i = 0; i < Test_ArenaCount; ++i)
+	{
+		PushBack(arenas, {X = i * width, Y = 0, Wdt = width, Hgt = LandscapeHeight()});
+	}
+	SetTestBatchMode(true);
+	LaunchTestsInArenas(1, arenas);
+	return true;
+}
+
+/* --- Some helper things --- */
+
+global func InitTest()
+{
+	var test = CurrentTest();
+	var arena = GetTestArena();
+	harness_start_frames[test.testnr] = FrameCounter();
+	test.rock = CreateObject(Rock, arena.X + arena.Wdt / 2, arena.Y + arena.Hgt / 2, NO_OWNER);
+	test.rock->SetCategory(C4D_StaticBack);
+	test.waited = false;
+	return true;
+}
+
+
+global func FinishTest()
+{
+	var test = CurrentTest();
+	if (test.rock)
+	{
+		test.rock->RemoveObject();
+	}
+}
+
+
+// Checks that the rock of the test stayed in its arena
+global func CheckTestArena()
+{
+	var test = CurrentTest();
+	var arena = GetTestArena();
+	var in_arena = test.rock
+	            && Inside(test.rock->GetX(), arena.X, arena.X + arena.Wdt - 1)
+	            && Inside(test.rock->GetY(), arena.Y, arena.Y + arena.Hgt - 1);
+	doTest("Object of the test is in its arena: %v, expected %v", in_arena, true);
+	doTest("Test runs in an arena: %v, expected %v", arena.Wdt < LandscapeWidth(), true);
+}
+
+/* --- Tests --- */
+
+//--------------------------------------------------------
+
+global func Test1_OnStart(int player){ return InitTest(); }
+global func Test1_OnFinished(){ return FinishTest(); }
+global func Test1_Execute()
+{
+	var test = CurrentTest();
+	if (!test.waited)
+	{
+		test.waited = true;
+		return Wait(5);
+	}
+	Log("Test in the first arena");
+	CheckTestArena();
+	return Evaluate();
+}
+
+//--------------------------------------------------------
+
+global func Test2_OnStart(int player){ return InitTest(); }
+global func Test2_OnFinished(){ return FinishTest(); }
+global func Test2_Execute()
+{
+	var test = CurrentTest();
+	if (!test.waited)
+	{
+		test.waited = true;
+		return Wait(5);
+	}
+	Log("Test in the second arena, started together with the first test");
+	CheckTestArena();
+	doTest("Started in frame %d, expected %d", harness_start_frames[2], harness_start_frames[1]);
+	return Evaluate();
+}
+
+//--------------------------------------------------------
+
+global func Test3_OnStart(int player){ return InitTest(); }
+global func Test3_OnFinished(){ return FinishTest(); }
+global func Test3_Execute()
+{
+	Log("Test without waiting, starts in the frame in which the previous test finished");
+	CheckTestArena();
+	doTest("Started after the first round: %v, expected %v", harness_start_frames[3] > harness_start_frames[1], true);
+	return Evaluate();
+}
+
+//--------------------------------------------------------
+
+global func Test4_OnStart(int player){ return InitTest(); }
+global func Test4_OnFinished(){ return FinishTest(); }
+global func Test4_Execute()
+{
+	Log("All arenas count into the same suite");
+	CheckTestArena();
+	var suite = GetTestSuite();
+	doTest("Suite counted %d tests, expected %d", suite.count_total, 4);
+	doTest("Suite counted %d failed tests, expected %d", suite.count_failed, 0);
+	return Evaluate();
+}